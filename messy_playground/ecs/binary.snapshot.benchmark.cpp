@@ -0,0 +1,92 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <entt/entity/registry.hpp>
+#include <nlohmann/json.hpp>
+#include <antara/gaming/ecs/binary.snapshot.hpp>
+
+using namespace antara::gaming;
+
+using benchmark_components = doom::meta::list<transform::position_2d, transform::properties, graphics::draw_order,
+        graphics::fill_color, graphics::sprite>;
+
+template<typename TFunctor>
+double measure_ms(TFunctor &&functor)
+{
+    auto start = std::chrono::steady_clock::now();
+    functor();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void fill(entt::registry &registry, std::size_t nb_entities)
+{
+    for (std::size_t i = 0; i < nb_entities; ++i) {
+        auto entity = registry.create();
+        registry.assign<transform::position_2d>(entity, float(i), float(i) * 0.5f);
+        registry.assign<transform::properties>(entity);
+        registry.assign<graphics::draw_order>(entity, graphics::draw_order{static_cast<std::uint32_t>(i % 12), 0.5f});
+        registry.assign<graphics::fill_color>(entity, graphics::white);
+        registry.assign<graphics::sprite>(entity, graphics::sprite{"sprite_" + std::to_string(i % 32)});
+    }
+}
+
+std::string save_json(entt::registry &registry)
+{
+    nlohmann::json entities = nlohmann::json::array();
+    registry.view<transform::position_2d, transform::properties, graphics::draw_order, graphics::fill_color, graphics::sprite>().each(
+            [&entities](auto &&pos, auto &&props, auto &&order, auto &&color, auto &&spr) {
+                entities.push_back({{"pos",      {pos.x(), pos.y()}},
+                                    {"scale",    {props.scale.x(), props.scale.y()}},
+                                    {"rotation", props.rotation},
+                                    {"layer",    order.layer},
+                                    {"depth",    order.depth},
+                                    {"color",    {color.r, color.g, color.b, color.a}},
+                                    {"sprite",   spr.appearance}});
+            });
+    return entities.dump();
+}
+
+void load_json(entt::registry &registry, const std::string &str)
+{
+    auto entities = nlohmann::json::parse(str);
+    for (auto &&json_entity : entities) {
+        auto entity = registry.create();
+        registry.assign<transform::position_2d>(entity, json_entity["pos"][0].get<float>(), json_entity["pos"][1].get<float>());
+        transform::properties props;
+        props.scale = math::vec2f{json_entity["scale"][0].get<float>(), json_entity["scale"][1].get<float>()};
+        props.rotation = json_entity["rotation"].get<float>();
+        registry.assign<transform::properties>(entity, props);
+        registry.assign<graphics::draw_order>(entity, graphics::draw_order{json_entity["layer"].get<std::uint32_t>(),
+                                                                           json_entity["depth"].get<float>()});
+        registry.assign<graphics::fill_color>(entity, json_entity["color"][0].get<std::uint8_t>(),
+                                              json_entity["color"][1].get<std::uint8_t>(),
+                                              json_entity["color"][2].get<std::uint8_t>(),
+                                              json_entity["color"][3].get<std::uint8_t>());
+        registry.assign<graphics::sprite>(entity, graphics::sprite{json_entity["sprite"].get<std::string>()});
+    }
+}
+
+int main()
+{
+    constexpr std::size_t nb_entities = 100'000u;
+    entt::registry registry;
+    fill(registry, nb_entities);
+
+    std::vector<std::uint8_t> snapshot;
+    auto binary_save = measure_ms([&]() { snapshot = ecs::save_binary_snapshot(registry, benchmark_components{}); });
+    entt::registry binary_registry;
+    auto binary_load = measure_ms([&]() {
+        static_cast<void>(ecs::load_binary_snapshot(binary_registry, snapshot, benchmark_components{}));
+    });
+
+    std::string json;
+    auto json_save = measure_ms([&]() { json = save_json(registry); });
+    entt::registry json_registry;
+    auto json_load = measure_ms([&]() { load_json(json_registry, json); });
+
+    std::cout << nb_entities << " entities\n";
+    std::cout << "binary: save " << binary_save << " ms, load " << binary_load << " ms, " << snapshot.size() << " bytes\n";
+    std::cout << "json:   save " << json_save << " ms, load " << json_load << " ms, " << json.size() << " bytes\n";
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <entt/entity/registry.hpp>
+#include <antara/gaming/ecs/change.tracker.hpp>
+#include <antara/gaming/transform/component.position.hpp>
+
+using namespace antara::gaming;
+
+template<typename Functor>
+double measure_ms(Functor &&functor)
+{
+    auto start = std::chrono::steady_clock::now();
+    functor();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    constexpr std::size_t nb_entities = 1'000'000u;
+    constexpr std::size_t nb_moved = 10'000u;
+    entt::registry registry;
+    auto &tracker = registry.set<ecs::change_tracker>();
+    tracker.track<transform::position_2d>(registry);
+    for (std::size_t i = 0; i < nb_entities; ++i) {
+        registry.assign<transform::position_2d>(registry.create(), float(i), 0.f);
+    }
+
+    //! 1% of the entities move during the frame
+    const auto since = tracker.tick();
+    std::size_t idx = 0u;
+    for (auto entity : registry.view<transform::position_2d>()) {
+        if (idx++ % (nb_entities / nb_moved) == 0u) {
+            registry.replace<transform::position_2d>(entity, 1.f, 1.f);
+        }
+    }
+
+    float checksum = 0.f;
+    auto full_scan = measure_ms([&]() {
+        registry.view<transform::position_2d>().each([&checksum](auto &pos) { checksum += pos.x(); });
+    });
+    std::size_t nb_visited = 0u;
+    auto changed_only = measure_ms([&]() {
+        nb_visited = tracker.each_changed<transform::position_2d>(registry, since, [&checksum](auto, auto &pos) {
+            checksum += pos.x();
+        });
+    });
+
+    std::cout << nb_entities << " entities, " << nb_visited << " changed\n";
+    std::cout << "full scan: " << full_scan << " ms\n";
+    std::cout << "changed since tick: " << changed_only << " ms\n";
+    std::cout << "checksum: " << checksum << "\n";
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#include <antara/gaming/ecs/system.hpp>
+#include <antara/gaming/timer/time.step.hpp>
+#include <antara/gaming/transform/component.position.hpp>
+#ifdef ANTARA_FOOTPRINT_CLIENT
+#include <antara/gaming/sfml/graphic.system.hpp>
+#include <antara/gaming/sfml/input.system.hpp>
+#include <antara/gaming/world/world.app.hpp>
+#else
+#include <antara/gaming/world/server.app.hpp>
+#endif
+
+using namespace antara::gaming;
+
+namespace
+{
+    constexpr std::size_t nb_entities = 10'000u;
+    constexpr std::size_t nb_frames = 600u;
+    const auto process_start = std::chrono::steady_clock::now();
+
+    double elapsed_ms()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - process_start).count();
+    }
+
+    long peak_rss_kb()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+#else
+        return -1;
+#endif
+    }
+}
+
+class movement_system final : public ecs::logic_update_system<movement_system>
+{
+public:
+    movement_system(entt::registry &registry) noexcept : system(registry)
+    {
+    }
+
+    void update() noexcept final
+    {
+        entity_registry_.view<transform::position_2d>().each([](auto, auto &&pos) {
+            pos.set_x(pos.x() + 1.f);
+        });
+        if (++nb_ticks == 1u) {
+            std::cout << "first tick after: " << elapsed_ms() << " ms\n";
+        }
+        if (nb_ticks == nb_frames) {
+            this->dispatcher_.trigger<event::quit_game>(0);
+        }
+    }
+
+    std::size_t nb_ticks{0u};
+};
+
+REFL_AUTO(type(movement_system))
+
+#ifdef ANTARA_FOOTPRINT_CLIENT
+class footprint_world : public world::app
+{
+public:
+    footprint_world() noexcept
+    {
+        auto &graphic_system = this->system_manager_.create_system<sfml::graphic_system>();
+        this->system_manager_.create_system<sfml::input_system>(graphic_system.get_window());
+#else
+class footprint_world : public world::server_app
+{
+public:
+    footprint_world() noexcept
+    {
+#endif
+        this->system_manager_.create_system<movement_system>();
+        for (std::size_t i = 0; i < nb_entities; ++i) {
+            this->entity_registry_.assign<transform::position_2d>(this->entity_registry_.create(), float(i), 0.f);
+        }
+        this->entity_registry_.ctx<timer::time_step>().set_clock_source(timer::clock_source::virtual_time);
+    }
+};
+
+int main()
+{
+#ifdef ANTARA_FOOTPRINT_CLIENT
+    std::cout << "client build\n";
+#else
+    std::cout << "server build\n";
+#endif
+    footprint_world world;
+    std::cout << "startup: " << elapsed_ms() << " ms, peak rss: " << peak_rss_kb() << " KB\n";
+    auto start = std::chrono::steady_clock::now();
+    auto return_value = world.run();
+    auto run_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << nb_frames << " frames: " << run_ms << " ms, peak rss: " << peak_rss_kb() << " KB\n";
+    return return_value;
+}
@@ -0,0 +1,60 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <entt/entity/registry.hpp>
+#include <antara/gaming/ecs/hierarchy.system.hpp>
+#include <antara/gaming/ecs/system.manager.hpp>
+
+using namespace antara::gaming;
+
+template<typename Functor>
+double measure_ms(Functor &&functor)
+{
+    auto start = std::chrono::steady_clock::now();
+    functor();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    constexpr std::size_t nb_roots = 1'000u;
+    constexpr std::size_t nb_children_per_level = 10u;
+    entt::registry registry;
+    entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+    static_cast<void>(dispatcher);
+    ecs::system_manager manager{registry};
+    auto &hierarchy = manager.create_system<ecs::hierarchy_system>();
+
+    //! roots with two levels of children, 110 entities per tree
+    std::vector<entt::entity> roots;
+    for (std::size_t i = 0; i < nb_roots; ++i) {
+        auto root = registry.create();
+        registry.assign<transform::position_2d>(root, float(i), 0.f);
+        registry.assign<transform::properties>(root);
+        roots.push_back(root);
+        for (std::size_t j = 0; j < nb_children_per_level; ++j) {
+            auto child = registry.create();
+            registry.assign<transform::parent_2d>(child, transform::parent_2d{root, math::vec2f{1.f, 0.f}});
+            for (std::size_t k = 0; k < nb_children_per_level; ++k) {
+                registry.assign<transform::parent_2d>(registry.create(),
+                                                      transform::parent_2d{child, math::vec2f{0.f, 1.f}});
+            }
+        }
+    }
+
+    auto first_pass = measure_ms([&]() { hierarchy.update(); });
+    const auto nb_first = hierarchy.nb_updated();
+    auto idle_pass = measure_ms([&]() { hierarchy.update(); });
+
+    //! 1% of the trees move
+    for (std::size_t i = 0; i < nb_roots; i += 100u) {
+        registry.replace<transform::position_2d>(roots[i], float(i), 1.f);
+    }
+    auto dirty_pass = measure_ms([&]() { hierarchy.update(); });
+
+    std::cout << "sort + full pass: " << first_pass << " ms, " << nb_first << " world transforms\n";
+    std::cout << "idle pass: " << idle_pass << " ms\n";
+    std::cout << "1% dirty pass: " << dirty_pass << " ms, " << hierarchy.nb_updated() << " world transforms\n";
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <thread>
+#include <entt/entity/registry.hpp>
+#include <antara/gaming/ecs/parallel.for.each.hpp>
+#include <antara/gaming/transform/component.position.hpp>
+
+using namespace antara::gaming;
+
+struct velocity
+{
+    float x;
+    float y;
+};
+
+int main()
+{
+    constexpr std::size_t nb_entities = 1'000'000u;
+    constexpr std::size_t nb_frames = 50u;
+    entt::registry registry;
+    registry.group<transform::position_2d, velocity>();
+    for (std::size_t i = 0; i < nb_entities; ++i) {
+        auto entity = registry.create();
+        registry.assign<transform::position_2d>(entity, 0.f, 0.f);
+        registry.assign<velocity>(entity, std::sin(float(i)), std::cos(float(i)));
+    }
+
+    auto group = registry.group<transform::position_2d, velocity>();
+    auto movement = [&group](entt::entity entity) {
+        auto &&[pos, vel] = group.get<transform::position_2d, velocity>(entity);
+        pos.set_x(pos.x() + vel.x * 0.016f);
+        pos.set_y(pos.y() + vel.y * 0.016f);
+    };
+
+    double serial_ms = 0.0;
+    const std::size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    for (std::size_t nb_threads = 1u; nb_threads <= max_threads; nb_threads *= 2u) {
+        ecs::worker_pool pool{nb_threads - 1u};
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t frame = 0; frame < nb_frames; ++frame) {
+            ecs::parallel_for_each(group, movement, pool);
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        auto frame_ms = elapsed / nb_frames;
+        if (nb_threads == 1u) {
+            serial_ms = frame_ms;
+        }
+        std::cout << nb_threads << " thread(s): " << frame_ms << " ms per frame, speedup x" << serial_ms / frame_ms
+                  << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <entt/entity/registry.hpp>
+#include <antara/gaming/ecs/rollback.buffer.hpp>
+#include <antara/gaming/ecs/system.hpp>
+#include <antara/gaming/ecs/system.manager.hpp>
+
+using namespace antara::gaming;
+
+struct body
+{
+    float x;
+    float y;
+    float vx;
+    float vy;
+};
+
+//! moves one body out of four each tick, so the deltas stay smaller than the state
+class move_system final : public ecs::logic_update_system<move_system>
+{
+public:
+    move_system(entt::registry &registry) noexcept : system(registry)
+    {
+
+    }
+
+    void update() noexcept final
+    {
+        std::size_t idx = 0u;
+        entity_registry_.view<body>().each([&idx](body &b) {
+            if (idx++ % 4u == 0u) {
+                b.x += b.vx;
+                b.y += b.vy;
+            }
+        });
+    }
+
+    ~move_system() noexcept final = default;
+};
+
+REFL_AUTO(type(move_system))
+
+template<typename Functor>
+double measure_ms(Functor &&functor)
+{
+    auto start = std::chrono::steady_clock::now();
+    functor();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    constexpr std::size_t nb_entities = 10'000u;
+    constexpr std::size_t nb_ticks = 120u;
+    constexpr std::size_t rollback_ticks = 8u;
+    entt::registry registry;
+    entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+    static_cast<void>(dispatcher);
+    ecs::rollback_buffer rollback{rollback_ticks};
+    rollback.track<body>();
+    ecs::system_manager manager{registry};
+    manager.create_system<move_system>();
+    for (std::size_t i = 0; i < nb_entities; ++i) {
+        registry.assign<body>(registry.create(), body{float(i), 0.f, 1.f, 0.5f});
+    }
+
+    std::uint64_t tick = 0u;
+    rollback.capture(registry, tick);
+    auto simulate = measure_ms([&]() {
+        for (std::size_t i = 0; i < nb_ticks; ++i) {
+            manager.update_systems(ecs::system_type::logic_update);
+            rollback.capture(registry, ++tick);
+        }
+    });
+
+    auto resimulate = measure_ms([&]() {
+        rollback.restore(registry, tick - rollback_ticks);
+        for (std::uint64_t current = tick - rollback_ticks; current < tick;) {
+            manager.update_systems(ecs::system_type::logic_update);
+            rollback.capture(registry, ++current);
+        }
+    });
+
+    std::cout << nb_entities << " entities, ring of " << rollback_ticks << " ticks\n";
+    std::cout << "tick + capture: " << simulate / nb_ticks << " ms\n";
+    std::cout << "restore + resimulate " << rollback_ticks << " ticks: " << resimulate << " ms (frame budget 16.6 ms)\n";
+    std::cout << "rollback memory: " << rollback.memory_usage() << " bytes\n";
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <antara/gaming/ecs/system.manager.hpp>
+
+using namespace antara::gaming;
+
+template<std::size_t N>
+class bench_system final : public ecs::logic_update_system<bench_system<N>>
+{
+public:
+    bench_system(entt::registry &registry) noexcept : ecs::logic_update_system<bench_system<N>>(registry)
+    {
+
+    }
+
+    void update() noexcept final
+    {
+
+    }
+
+    ~bench_system() noexcept final = default;
+};
+
+REFL_AUTO(template((std::size_t N), (bench_system<N>)))
+
+template<std::size_t... Is>
+void create_systems(ecs::system_manager &mgr, std::index_sequence<Is...>)
+{
+    (mgr.create_system<bench_system<Is>>(), ...);
+}
+
+template<typename TFunctor>
+void bench(const char *name, std::size_t nb_iterations, TFunctor &&functor)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::size_t found = 0u;
+    for (std::size_t i = 0; i < nb_iterations; ++i) {
+        found += functor() ? 1u : 0u;
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << elapsed / nb_iterations << " ns per lookup (" << found << " hits)\n";
+}
+
+int main()
+{
+    constexpr std::size_t nb_systems = 200u;
+    constexpr std::size_t nb_iterations = 1'000'000u;
+    entt::registry registry;
+    registry.set<entt::dispatcher>();
+    ecs::system_manager mgr{registry};
+    create_systems(mgr, std::make_index_sequence<nb_systems>{});
+    std::cout << mgr.nb_systems() << " systems registered\n";
+
+    bench("has_system (first)", nb_iterations, [&mgr]() { return mgr.has_system<bench_system<0>>(); });
+    bench("has_system (last)", nb_iterations,
+          [&mgr]() { return mgr.has_system<bench_system<nb_systems - 1>>(); });
+    bench("get_system (last)", nb_iterations,
+          [&mgr]() { return mgr.get_system<bench_system<nb_systems - 1>>().is_enabled(); });
+    bench("disable_system (middle)", nb_iterations,
+          [&mgr]() { return mgr.disable_system<bench_system<nb_systems / 2>>(); });
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <antara/gaming/ecs/static.system.pipeline.hpp>
+#include <antara/gaming/ecs/system.manager.hpp>
+
+using namespace antara::gaming;
+
+static std::size_t counter = 0u;
+
+template<std::size_t N>
+class bench_system final : public ecs::logic_update_system<bench_system<N>>
+{
+public:
+    bench_system(entt::registry &registry) noexcept : ecs::logic_update_system<bench_system<N>>(registry)
+    {
+
+    }
+
+    void update() noexcept final
+    {
+        counter += N;
+    }
+
+    ~bench_system() noexcept final = default;
+};
+
+REFL_AUTO(template((std::size_t N), (bench_system<N>)))
+
+template<std::size_t... Is>
+void create_systems(ecs::system_manager &mgr, std::index_sequence<Is...>)
+{
+    (mgr.create_system<bench_system<Is>>(), ...);
+}
+
+template<std::size_t... Is>
+auto make_pipeline_type(std::index_sequence<Is...>) -> ecs::static_system_pipeline<bench_system<Is>...>;
+
+template<typename TFunctor>
+void bench(const char *name, std::size_t nb_frames, TFunctor &&functor)
+{
+    counter = 0u;
+    std::size_t nb_updates = 0u;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < nb_frames; ++i) {
+        nb_updates += functor();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << elapsed / nb_updates << " ns per system update (" << counter << ")\n";
+}
+
+int main()
+{
+    constexpr std::size_t nb_systems = 64u;
+    constexpr std::size_t nb_frames = 100'000u;
+    entt::registry registry;
+    registry.set<entt::dispatcher>();
+
+    ecs::system_manager mgr{registry};
+    create_systems(mgr, std::make_index_sequence<nb_systems>{});
+    mgr.disable_system<ecs::interpolation_system>();
+    mgr.disable_system<bench_system<nb_systems / 2>>();
+
+    using pipeline_t = decltype(make_pipeline_type(std::make_index_sequence<nb_systems>{}));
+    pipeline_t pipeline{registry};
+    pipeline.disable_system<bench_system<nb_systems / 2>>();
+
+    bench("dynamic system_manager", nb_frames,
+          [&mgr]() { return mgr.update_systems(ecs::system_type::logic_update); });
+    bench("static_system_pipeline", nb_frames,
+          [&pipeline]() { return pipeline.update_systems<ecs::system_type::logic_update>(); });
+    return 0;
+}
@@ -92,7 +92,7 @@ public:
         entity_registry.assign<graphics::layer<4>>(animated_entity);
 
         animation2d_system.add_animation("bheet_arrival", "bheet_arrival.png", 12, 7, 80);
-        antara::gaming::timer::time_step::reset_lag();
+        entity_registry.ctx<antara::gaming::timer::time_step>().reset_lag();
         auto animated2_entity = animation2d::blueprint_animation(entity_registry,
                                                                  animation2d::anim_component{"bheet_arrival",
                                                                                              animation2d::anim_component::status::playing,
@@ -14,8 +14,12 @@
  *                                                                            *
  ******************************************************************************/
 
+#include <vector>
 #include <doctest/doctest.h>
+#include <entt/entity/helper.hpp>
+#include <entt/signal/dispatcher.hpp>
 #include "antara/gaming/collisions/basic.collision.system.hpp"
+#include "antara/gaming/event/event.bus.hpp"
 
 namespace antara::gaming::collisions::tests
 {
@@ -68,4 +72,223 @@ namespace antara::gaming::collisions::tests
                     CHECK_FALSE(collisions::basic_collision_system::query_rect(registry, entity, another_entity));
         }
     }
-}
\ No newline at end of file
+
+    struct collision_listener
+    {
+        std::vector<collisions::event::collision_begin> begins;
+        std::vector<collisions::event::collision_end> ends;
+
+        void on_begin(const collisions::event::collision_begin &evt)
+        {
+            begins.push_back(evt);
+        }
+
+        void on_end(const collisions::event::collision_end &evt)
+        {
+            ends.push_back(evt);
+        }
+    };
+
+    entt::entity create_collider(entt::registry &registry, float x, float y, collider filter = {})
+    {
+        auto entity = registry.create();
+        registry.assign<transform::properties>(entity, math::vec2f::scalar(1.f), 0.f, transform::ts_rect{},
+                                               transform::ts_rect{.pos = {x, y}, .size = {10.f, 10.f}});
+        registry.assign<collider>(entity, filter);
+        return entity;
+    }
+
+    void move_collider(entt::registry &registry, entt::entity entity, float x, float y)
+    {
+        auto props = registry.get<transform::properties>(entity);
+        props.global_bounds.pos = {x, y};
+        registry.replace<transform::properties>(entity, props);
+    }
+
+    TEST_CASE ("collision pairs persist across ticks")
+    {
+        entt::registry registry;
+        auto &dispatcher = registry.set<entt::dispatcher>();
+        collision_listener listener;
+        dispatcher.sink<collisions::event::collision_begin>().connect<&collision_listener::on_begin>(listener);
+        dispatcher.sink<collisions::event::collision_end>().connect<&collision_listener::on_end>(listener);
+        basic_collision_system system{registry};
+                CHECK(system.is_enabled());
+
+        auto player = create_collider(registry, 0.f, 0.f);
+        auto wall = create_collider(registry, 5.f, 5.f);
+        auto far_away = create_collider(registry, 100.f, 100.f);
+        system.update();
+                REQUIRE_EQ(listener.begins.size(), 1u);
+                CHECK_EQ(listener.begins[0].first, player);
+                CHECK_EQ(listener.begins[0].second, wall);
+                CHECK(system.are_colliding(wall, player));
+                CHECK_FALSE(system.are_colliding(player, far_away));
+                CHECK_EQ(system.get_stats().nb_colliders, 3u);
+
+        //! still overlapping: nothing is emitted
+        move_collider(registry, wall, 6.f, 6.f);
+        system.update();
+                CHECK_EQ(listener.begins.size(), 1u);
+                CHECK(listener.ends.empty());
+                CHECK_EQ(system.get_stats().nb_pairs, 1u);
+
+        move_collider(registry, wall, 50.f, 50.f);
+        system.update();
+                REQUIRE_EQ(listener.ends.size(), 1u);
+                CHECK_EQ(listener.ends[0].first, player);
+                CHECK_EQ(listener.ends[0].second, wall);
+                CHECK_FALSE(system.are_colliding(player, wall));
+        system.update();
+                CHECK_EQ(listener.ends.size(), 1u);
+    }
+
+    TEST_CASE ("colliders which cannot interact are filtered before the bounds test")
+    {
+        constexpr std::uint32_t player_layer = 1u << 0u;
+        constexpr std::uint32_t enemy_layer = 1u << 1u;
+        constexpr std::uint32_t bullet_layer = 1u << 2u;
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        basic_collision_system system{registry};
+        auto player = create_collider(registry, 0.f, 0.f, {player_layer, enemy_layer});
+        auto enemy = create_collider(registry, 2.f, 2.f, {enemy_layer, player_layer | bullet_layer});
+        auto bullet = create_collider(registry, 4.f, 4.f, {bullet_layer, enemy_layer});
+        system.update();
+                CHECK(system.are_colliding(player, enemy));
+                CHECK(system.are_colliding(enemy, bullet));
+                CHECK_FALSE(system.are_colliding(player, bullet));
+                CHECK_EQ(system.get_stats().nb_filtered_pairs, 1u);
+                CHECK_EQ(system.get_stats().nb_bounds_tests, 2u);
+    }
+
+    TEST_CASE ("collision events go through the event bus when it listens to them")
+    {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        auto &bus = registry.set<gaming::event::event_bus>();
+        std::size_t nb_begins = 0u;
+        bus.connect<collisions::event::collision_begin>(
+                [&nb_begins](gaming::event::event_span<collisions::event::collision_begin> events) {
+                    nb_begins += events.size;
+                });
+        basic_collision_system system{registry};
+        create_collider(registry, 0.f, 0.f);
+        create_collider(registry, 1.f, 1.f);
+        system.update();
+                CHECK_EQ(nb_begins, 0u);
+        bus.drain();
+                CHECK_EQ(nb_begins, 1u);
+    }
+
+    TEST_CASE ("swept rect returns the time of impact")
+    {
+        transform::ts_rect bullet{.pos = {0.f, 0.f}, .size = {2.f, 2.f}};
+        transform::ts_rect thin_wall{.pos = {50.f, -10.f}, .size = {1.f, 30.f}};
+        auto hit = basic_collision_system::sweep_rect(bullet, {100.f, 0.f}, thin_wall);
+                REQUIRE(hit.has_value());
+                CHECK_EQ(hit->time_of_impact, doctest::Approx(0.48f));
+                CHECK_EQ(hit->normal, math::vec2f{-1.f, 0.f});
+                CHECK_FALSE(basic_collision_system::query_rect({.pos = {100.f, 0.f}, .size = {2.f, 2.f}}, thin_wall));
+
+                CHECK_FALSE(basic_collision_system::sweep_rect(bullet, {40.f, 0.f}, thin_wall).has_value());
+                CHECK_FALSE(basic_collision_system::sweep_rect(bullet, {48.f, 0.f}, thin_wall).has_value());
+                CHECK_FALSE(basic_collision_system::sweep_rect(bullet, {100.f, -30.f}, thin_wall).has_value());
+
+        auto already_in = basic_collision_system::sweep_rect({.pos = {50.f, 0.f}, .size = {2.f, 2.f}}, {10.f, 0.f},
+                                                             thin_wall);
+                REQUIRE(already_in.has_value());
+                CHECK_EQ(already_in->time_of_impact, 0.f);
+                CHECK_EQ(already_in->normal, math::vec2f::scalar(0.f));
+    }
+
+    TEST_CASE ("fast dynamic colliders do not tunnel through thin ones")
+    {
+        entt::registry registry;
+        auto &dispatcher = registry.set<entt::dispatcher>();
+        collision_listener listener;
+        dispatcher.sink<collisions::event::collision_begin>().connect<&collision_listener::on_begin>(listener);
+        basic_collision_system system{registry};
+
+        auto bullet = registry.create();
+        registry.assign<transform::position_2d>(bullet, 100.f, 0.f);
+        registry.assign<transform::previous_position_2d>(bullet, 0.f, 0.f);
+        registry.assign<entt::tag<"dynamic"_hs>>(bullet);
+        registry.assign<transform::properties>(bullet, math::vec2f::scalar(1.f), 0.f, transform::ts_rect{},
+                                               transform::ts_rect{.pos = {100.f, 0.f}, .size = {2.f, 2.f}});
+        registry.assign<collider>(bullet);
+        auto thin_wall = registry.create();
+        registry.assign<transform::properties>(thin_wall, math::vec2f::scalar(1.f), 0.f, transform::ts_rect{},
+                                               transform::ts_rect{.pos = {50.f, -10.f}, .size = {1.f, 30.f}});
+        registry.assign<collider>(thin_wall);
+
+        system.update();
+                REQUIRE_EQ(listener.begins.size(), 1u);
+                CHECK(system.are_colliding(bullet, thin_wall));
+                CHECK_EQ(system.get_stats().nb_swept_tests, 1u);
+                REQUIRE_EQ(system.get_contacts().size(), 1u);
+        const auto &contact = system.get_contacts()[0];
+                CHECK_EQ(contact.first, bullet);
+                CHECK_EQ(contact.second, thin_wall);
+                CHECK_EQ(contact.hit.time_of_impact, doctest::Approx(0.48f));
+                CHECK_EQ(contact.hit.normal, math::vec2f{-1.f, 0.f});
+                CHECK(basic_collision_system::sweep_rect(registry, bullet, thin_wall).has_value());
+
+        //! the bullet went past the wall, it stays still from now on
+        registry.replace<transform::previous_position_2d>(bullet, 100.f, 0.f);
+        system.update();
+                CHECK_FALSE(system.are_colliding(bullet, thin_wall));
+                CHECK(system.get_contacts().empty());
+    }
+
+    TEST_CASE ("sized colliders do not need the bounds of a graphic system")
+    {
+        entt::registry registry;
+        auto &dispatcher = registry.set<entt::dispatcher>();
+        collision_listener listener;
+        dispatcher.sink<collisions::event::collision_begin>().connect<&collision_listener::on_begin>(listener);
+        basic_collision_system system{registry};
+        auto first = registry.create();
+        registry.assign<transform::position_2d>(first, 0.f, 0.f);
+        registry.assign<collider>(first, 1u, 0xFFFFFFFFu, math::vec2f{10.f, 10.f});
+        auto second = registry.create();
+        registry.assign<transform::position_2d>(second, 8.f, 0.f);
+        registry.assign<collider>(second, 1u, 0xFFFFFFFFu, math::vec2f{10.f, 10.f});
+        //! stale global_bounds are ignored when the collider has a size
+        registry.assign<transform::properties>(second, math::vec2f::scalar(1.f), 0.f, transform::ts_rect{},
+                                               transform::ts_rect{.pos = {500.f, 500.f}, .size = {1.f, 1.f}});
+        system.update();
+                CHECK(system.are_colliding(first, second));
+                CHECK_EQ(listener.begins.size(), 1u);
+                CHECK(basic_collision_system::query_rect(registry, first, second));
+                CHECK(basic_collision_system::query_point(registry, first, transform::position_2d{4.f, -4.f}));
+
+        registry.replace<transform::position_2d>(second, 11.f, 0.f);
+        system.update();
+                CHECK_FALSE(system.are_colliding(first, second));
+    }
+
+    TEST_CASE ("pairs of destroyed entities end without event")
+    {
+        entt::registry registry;
+        auto &dispatcher = registry.set<entt::dispatcher>();
+        collision_listener listener;
+        dispatcher.sink<collisions::event::collision_begin>().connect<&collision_listener::on_begin>(listener);
+        dispatcher.sink<collisions::event::collision_end>().connect<&collision_listener::on_end>(listener);
+        basic_collision_system system{registry};
+        auto player = create_collider(registry, 0.f, 0.f);
+        auto wall = create_collider(registry, 5.f, 5.f);
+        auto bullet = create_collider(registry, 2.f, 2.f);
+        system.update();
+                CHECK_EQ(listener.begins.size(), 3u);
+
+        registry.destroy(bullet);
+        move_collider(registry, wall, 100.f, 100.f);
+        system.update();
+                REQUIRE_EQ(listener.ends.size(), 1u);
+                CHECK_EQ(listener.ends[0].first, player);
+                CHECK_EQ(listener.ends[0].second, wall);
+                CHECK_EQ(system.get_stats().nb_dropped_ends, 2u);
+                CHECK(system.get_pairs().empty());
+    }
+}
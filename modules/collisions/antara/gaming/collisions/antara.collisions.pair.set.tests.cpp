@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include "antara/gaming/collisions/pair.set.hpp"
+
+namespace antara::gaming::collisions::tests
+{
+    TEST_CASE ("pair keys do not depend on the order of the entities")
+    {
+        auto first = static_cast<entt::entity>(3u);
+        auto second = static_cast<entt::entity>(42u);
+                CHECK_EQ(pair_set::make_key(first, second), pair_set::make_key(second, first));
+        auto[lhs, rhs] = pair_set::split_key(pair_set::make_key(second, first));
+                CHECK_EQ(lhs, first);
+                CHECK_EQ(rhs, second);
+                CHECK_NE(pair_set::make_key(first, second), pair_set::make_key(first, first));
+    }
+
+    TEST_CASE ("insert, contains and clear")
+    {
+        pair_set set{4u};
+                CHECK(set.empty());
+                CHECK_EQ(set.capacity(), 8u);
+        const auto key = pair_set::make_key(static_cast<entt::entity>(1u), static_cast<entt::entity>(2u));
+                CHECK(set.insert(key));
+                CHECK_FALSE(set.insert(key));
+                CHECK(set.contains(key));
+                CHECK_EQ(set.size(), 1u);
+        set.clear();
+                CHECK(set.empty());
+                CHECK_FALSE(set.contains(key));
+                CHECK_EQ(set.capacity(), 8u);
+    }
+
+    TEST_CASE ("the table grows and keeps every pair")
+    {
+        pair_set set;
+        for (std::uint32_t i = 0u; i < 1000u; ++i) {
+                    CHECK(set.insert(pair_set::make_key(static_cast<entt::entity>(i), static_cast<entt::entity>(i + 1u))));
+        }
+                CHECK_EQ(set.size(), 1000u);
+                CHECK_GE(set.capacity(), 2000u);
+        std::size_t nb_keys = 0u;
+        set.for_each([&nb_keys](pair_set::key_type) { ++nb_keys; });
+                CHECK_EQ(nb_keys, 1000u);
+        for (std::uint32_t i = 0u; i < 1000u; ++i) {
+                    CHECK(set.contains(pair_set::make_key(static_cast<entt::entity>(i + 1u), static_cast<entt::entity>(i))));
+                    CHECK_FALSE(set.contains(pair_set::make_key(static_cast<entt::entity>(i), static_cast<entt::entity>(i + 2u))));
+        }
+    }
+}
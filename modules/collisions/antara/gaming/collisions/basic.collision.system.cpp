@@ -15,12 +15,65 @@
  ******************************************************************************/
 
 //! C++ System Headers
-#include <algorithm> ///< std::min, std::max
+#include <algorithm> ///< std::min, std::max, std::sort
+#include <utility> ///< std::swap
+
+//! Dependencies Headers
+#include <entt/entity/helper.hpp> ///< entt::tag
 
 //! SDK Headers
 #include "antara/gaming/collisions/basic.collision.system.hpp"
+#include "antara/gaming/event/event.bus.hpp" ///< event::event_bus
 #include "antara/gaming/math/vector.hpp" ///< math::vec2f
 
+//! Anonymous Implementation
+namespace {
+    using namespace antara::gaming;
+
+    struct box {
+        math::vec2f min;
+        math::vec2f max;
+    };
+
+    box box_of(const transform::ts_rect &rect) noexcept {
+        auto[x, y] = rect.pos;
+        auto[width, height] = rect.size;
+        return {{std::min(x, x + width), std::min(y, y + height)}, {std::max(x, x + width), std::max(y, y + height)}};
+    }
+
+    //! previous_position_2d is only refreshed for the dynamic entities, the others are considered still
+    math::vec2f displacement_of(entt::registry &registry, entt::entity entity) noexcept {
+        if (not registry.has<entt::tag<"dynamic"_hs>>(entity)) {
+            return math::vec2f::scalar(0.f);
+        }
+        auto current = registry.try_get<transform::position_2d>(entity);
+        auto previous = registry.try_get<transform::previous_position_2d>(entity);
+        if (current == nullptr || previous == nullptr) {
+            return math::vec2f::scalar(0.f);
+        }
+        return static_cast<math::vec2f>(*current) - static_cast<math::vec2f>(*previous);
+    }
+
+    transform::ts_rect start_of(const transform::ts_rect &rect, math::vec2f displacement) noexcept {
+        return {rect.pos - displacement, rect.size};
+    }
+
+    //! a sized collider does not depend on the global_bounds filled by the graphic system
+    std::optional<transform::ts_rect> bounds_of(entt::registry &registry, entt::entity entity) noexcept {
+        using antara::gaming::collisions::collider;
+        if (auto cmp_collider = registry.try_get<collider>(entity); cmp_collider != nullptr &&
+                                                                    cmp_collider->size != math::vec2f::scalar(0.f)) {
+            if (auto pos = registry.try_get<transform::position_2d>(entity); pos != nullptr) {
+                return transform::ts_rect{static_cast<math::vec2f>(*pos) - cmp_collider->size / 2.f, cmp_collider->size};
+            }
+        }
+        if (auto props = registry.try_get<transform::properties>(entity); props != nullptr) {
+            return props->global_bounds;
+        }
+        return std::nullopt;
+    }
+}
+
 //! Static functions
 namespace antara::gaming::collisions {
     bool basic_collision_system::query_rect(transform::ts_rect first, transform::ts_rect second) noexcept {
@@ -36,10 +89,10 @@ namespace antara::gaming::collisions {
 
     bool basic_collision_system::query_rect(entt::registry &registry, entt::entity entity,
                                             entt::entity second_entity) noexcept {
-        auto properties_entity = registry.try_get<transform::properties>(entity);
-        auto properties_second_entity = registry.try_get<transform::properties>(second_entity);
-        return properties_entity == nullptr || properties_second_entity == nullptr ? false : query_rect(
-                properties_entity->global_bounds, properties_second_entity->global_bounds);
+        auto bounds_entity = bounds_of(registry, entity);
+        auto bounds_second_entity = bounds_of(registry, second_entity);
+        return bounds_entity.has_value() && bounds_second_entity.has_value() &&
+               query_rect(bounds_entity.value(), bounds_second_entity.value());
     }
 
     bool basic_collision_system::query_point(transform::ts_rect box, transform::position_2d pos) noexcept {
@@ -57,16 +110,193 @@ namespace antara::gaming::collisions {
 
     bool basic_collision_system::query_point(entt::registry &registry, entt::entity entity,
                                              transform::position_2d pos) noexcept {
-        auto properties_entity = registry.try_get<transform::properties>(entity);
-        return properties_entity == nullptr ? false : query_point(properties_entity->global_bounds, pos);
+        auto bounds_entity = bounds_of(registry, entity);
+        return bounds_entity.has_value() && query_point(bounds_entity.value(), pos);
+    }
+
+    std::optional<basic_collision_system::sweep_hit>
+    basic_collision_system::sweep_rect(transform::ts_rect moving, math::vec2f displacement,
+                                       transform::ts_rect target) noexcept {
+        const auto moving_box = box_of(moving);
+        const auto target_box = box_of(target);
+        float entry = 0.f;
+        float exit = 1.f;
+        int entry_axis = -1;
+        for (int axis = 0; axis < 2; ++axis) {
+            const float delta = displacement[axis];
+            if (delta == 0.f) {
+                if (moving_box.max[axis] <= target_box.min[axis] || moving_box.min[axis] >= target_box.max[axis]) {
+                    return std::nullopt;
+                }
+                continue;
+            }
+            const float axis_entry = (delta > 0.f ? target_box.min[axis] - moving_box.max[axis] :
+                                      target_box.max[axis] - moving_box.min[axis]) / delta;
+            const float axis_exit = (delta > 0.f ? target_box.max[axis] - moving_box.min[axis] :
+                                     target_box.min[axis] - moving_box.max[axis]) / delta;
+            if (axis_entry > entry) {
+                entry = axis_entry;
+                entry_axis = axis;
+            }
+            exit = std::min(exit, axis_exit);
+        }
+        //! touching boxes do not collide, as in query_rect
+        if (entry >= exit) {
+            return std::nullopt;
+        }
+        sweep_hit hit{entry};
+        if (entry_axis != -1) {
+            hit.normal[entry_axis] = displacement[entry_axis] > 0.f ? -1.f : 1.f;
+        }
+        return hit;
+    }
+
+    std::optional<basic_collision_system::sweep_hit>
+    basic_collision_system::sweep_rect(entt::registry &registry, entt::entity moving, entt::entity target) noexcept {
+        auto bounds_moving = bounds_of(registry, moving);
+        auto bounds_target = bounds_of(registry, target);
+        if (not bounds_moving.has_value() || not bounds_target.has_value()) {
+            return std::nullopt;
+        }
+        const auto moving_displacement = displacement_of(registry, moving);
+        const auto target_displacement = displacement_of(registry, target);
+        return sweep_rect(start_of(bounds_moving.value(), moving_displacement),
+                          moving_displacement - target_displacement,
+                          start_of(bounds_target.value(), target_displacement));
     }
 }
 
 //! Public Functions
 namespace antara::gaming::collisions {
     basic_collision_system::basic_collision_system(entt::registry &entity_registry) noexcept : system(entity_registry) {
-        this->disable();
     }
 
-    void basic_collision_system::update() noexcept {}
+    void basic_collision_system::update() noexcept {
+        stats_ = {};
+        collect_candidates_();
+        std::swap(previous_pairs_, current_pairs_);
+        current_pairs_.clear();
+        find_pairs_();
+        emit_events_();
+    }
+
+    bool basic_collision_system::are_colliding(entt::entity first, entt::entity second) const noexcept {
+        return current_pairs_.contains(pair_set::make_key(first, second));
+    }
+
+    const pair_set &basic_collision_system::get_pairs() const noexcept {
+        return current_pairs_;
+    }
+
+    const basic_collision_system::stats &basic_collision_system::get_stats() const noexcept {
+        return stats_;
+    }
+
+    const std::vector<basic_collision_system::contact> &basic_collision_system::get_contacts() const noexcept {
+        return contacts_;
+    }
+}
+
+//! Private Functions
+namespace antara::gaming::collisions {
+    void basic_collision_system::collect_candidates_() noexcept {
+        candidates_.clear();
+        entity_registry_.view<collider>().each([this](auto entity, auto &&cmp_collider) {
+            const auto bounds = bounds_of(entity_registry_, entity);
+            if (not bounds.has_value()) {
+                return;
+            }
+            const auto displacement = displacement_of(entity_registry_, entity);
+            const auto end = box_of(bounds.value());
+            const auto start = box_of(start_of(bounds.value(), displacement));
+            candidates_.push_back({entity, std::min(start.min.x(), end.min.x()), std::max(start.max.x(), end.max.x()),
+                                   std::min(start.min.y(), end.min.y()), std::max(start.max.y(), end.max.y()),
+                                   bounds.value(), displacement, cmp_collider});
+        });
+        std::sort(candidates_.begin(), candidates_.end(), [](const candidate &lhs, const candidate &rhs) {
+            return lhs.min_x < rhs.min_x;
+        });
+        stats_.nb_colliders = candidates_.size();
+    }
+
+    bool basic_collision_system::test_pair_(const candidate &first, const candidate &second) noexcept {
+        if (not(first.min_y < second.max_y && second.min_y < first.max_y)) {
+            return false;
+        }
+        //! still colliders: the swept bounds are the bounds, overlapping on x is implied by the sweep
+        const auto still = math::vec2f::scalar(0.f);
+        if (first.displacement == still && second.displacement == still) {
+            return true;
+        }
+        ++stats_.nb_swept_tests;
+        auto hit = sweep_rect(start_of(first.bounds, first.displacement), first.displacement - second.displacement,
+                              start_of(second.bounds, second.displacement));
+        if (not hit.has_value()) {
+            return false;
+        }
+        contact result{first.entity, second.entity, hit.value()};
+        if (pair_set::split_key(pair_set::make_key(first.entity, second.entity)).first != first.entity) {
+            std::swap(result.first, result.second);
+            result.hit.normal = -result.hit.normal;
+        }
+        contacts_.push_back(result);
+        return true;
+    }
+
+    void basic_collision_system::find_pairs_() noexcept {
+        begins_.clear();
+        contacts_.clear();
+        for (std::size_t i = 0u; i < candidates_.size(); ++i) {
+            const auto &first = candidates_[i];
+            //! sorted on min_x: the sweep stops at the first candidate starting past the end of this one
+            for (std::size_t j = i + 1u; j < candidates_.size() && candidates_[j].min_x < first.max_x; ++j) {
+                const auto &second = candidates_[j];
+                if (not collider::can_interact(first.filter, second.filter)) {
+                    ++stats_.nb_filtered_pairs;
+                    continue;
+                }
+                ++stats_.nb_bounds_tests;
+                if (test_pair_(first, second)) {
+                    const auto key = pair_set::make_key(first.entity, second.entity);
+                    if (current_pairs_.insert(key) && not previous_pairs_.contains(key)) {
+                        begins_.push_back(key);
+                    }
+                }
+            }
+        }
+        ends_.clear();
+        previous_pairs_.for_each([this](pair_set::key_type key) {
+            if (current_pairs_.contains(key)) {
+                return;
+            }
+            //! a destroyed entity can't be handed to the listeners, its pairs end without event
+            auto[first, second] = pair_set::split_key(key);
+            if (not entity_registry_.valid(first) || not entity_registry_.valid(second)) {
+                ++stats_.nb_dropped_ends;
+                return;
+            }
+            ends_.push_back(key);
+        });
+        //! the table order depends on its history, sorted so replaying the same ticks emits the same events
+        std::sort(ends_.begin(), ends_.end());
+        stats_.nb_pairs = current_pairs_.size();
+        stats_.nb_begins = begins_.size();
+        stats_.nb_ends = ends_.size();
+    }
+
+    void basic_collision_system::emit_events_() noexcept {
+        auto bus = entity_registry_.try_ctx<gaming::event::event_bus>();
+        for (auto &&key : ends_) {
+            auto[first, second] = pair_set::split_key(key);
+            if (bus == nullptr || not bus->enqueue<event::collision_end>(first, second)) {
+                this->dispatcher_.trigger<event::collision_end>(first, second);
+            }
+        }
+        for (auto &&key : begins_) {
+            auto[first, second] = pair_set::split_key(key);
+            if (bus == nullptr || not bus->enqueue<event::collision_begin>(first, second)) {
+                this->dispatcher_.trigger<event::collision_begin>(first, second);
+            }
+        }
+    }
 }
@@ -16,18 +16,73 @@
 
 #pragma once
 
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint32_t
+
+//! C++ System Headers
+#include <optional> ///< std::optional
+#include <vector> ///< std::vector
+
 //! Dependencies Headers
 #include <entt/entity/entity.hpp> ///< entt::entity
 #include <entt/entity/registry.hpp> ///< entt::registry
 
 //! SDK Headers
+#include "antara/gaming/collisions/component.collider.hpp" ///< collisions::collider
+#include "antara/gaming/collisions/event.collision.hpp" ///< collisions::event::collision_begin, collisions::event::collision_end
+#include "antara/gaming/collisions/pair.set.hpp" ///< collisions::pair_set
 #include "antara/gaming/ecs/system.hpp" ///< ecs::system
+#include "antara/gaming/math/vector.hpp" ///< math::vec2f
 #include "antara/gaming/transform/component.position.hpp" ///< transform::position2d
 #include "antara/gaming/transform/component.properties.hpp" ///< transform::properties, transform::ts_rect
 
 namespace antara::gaming::collisions {
-    class basic_collision_system final : ecs::logic_update_system<basic_collision_system> {
+    /**
+     * @class basic_collision_system
+     * @brief Keeps the set of overlapping pairs of colliders across ticks and emits an event when a pair starts or stops overlapping.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Entities take part with a collisions::collider, their box is the size of the collider centered on their position
+     *         or, for a null size, the global_bounds of their transform::properties (see collisions::collider).
+     *         The colliders are sorted on x and swept, the layer/mask filter is applied before the bounds test.
+     *         Dynamic colliders (tagged "dynamic"_hs) are tested continuously: their bounds are swept from transform::previous_position_2d
+     *         to transform::position_2d, so a fast collider cannot tunnel through a thin one between two ticks.
+     *         The system has to update after the systems moving the entities, previous_position_2d being refreshed by the
+     *         interpolation_system at the beginning of the logic tick.
+     *         collision_begin and collision_end go through the event::event_bus of the registry context when one listens to them,
+     *         through the dispatcher otherwise. Nothing is emitted for the pairs which keep overlapping,
+     *         nor for the pairs ended by the destruction of one of their entities: collision_end only carries valid entities.
+     * @endverbatim
+     */
+    class basic_collision_system final : public ecs::logic_update_system<basic_collision_system> {
     public:
+        //! Public typedefs
+        struct stats {
+            std::size_t nb_colliders{0u};
+            std::size_t nb_filtered_pairs{0u}; ///< pairs close on x skipped by the layer/mask filter
+            std::size_t nb_bounds_tests{0u};
+            std::size_t nb_swept_tests{0u}; ///< bounds tests involving a dynamic collider
+            std::size_t nb_pairs{0u}; ///< overlapping pairs
+            std::size_t nb_begins{0u};
+            std::size_t nb_ends{0u};
+            std::size_t nb_dropped_ends{0u}; ///< ended pairs involving a destroyed entity, no event is emitted for them
+        };
+
+        //! Result of a swept test
+        struct sweep_hit {
+            float time_of_impact{0.f}; ///< fraction of the displacement, between 0 (already overlapping) and 1
+            math::vec2f normal{math::vec2f::scalar(0.f)}; ///< face of the target which is hit, zero if already overlapping
+        };
+
+        //! Pair involving a dynamic collider, the hit is seen from first moving toward second
+        struct contact {
+            entt::entity first{entt::null};
+            entt::entity second{entt::null};
+            sweep_hit hit;
+        };
+
         //! Constructor
         basic_collision_system(entt::registry &entity_registry) noexcept;
 
@@ -37,6 +92,18 @@ namespace antara::gaming::collisions {
         //! Public member functions
         void update() noexcept final;
 
+        /// @return true if the two entities were overlapping at the last update
+        [[nodiscard]] bool are_colliding(entt::entity first, entt::entity second) const noexcept;
+
+        /// @return the overlapping pairs of the last update
+        [[nodiscard]] const pair_set &get_pairs() const noexcept;
+
+        /// @return counters of the last update
+        [[nodiscard]] const stats &get_stats() const noexcept;
+
+        /// @return the overlapping pairs of the last update involving a dynamic collider, with their time of impact
+        [[nodiscard]] const std::vector<contact> &get_contacts() const noexcept;
+
         //! Public static functions
         static bool query_rect(transform::ts_rect first, transform::ts_rect second) noexcept;
 
@@ -45,6 +112,51 @@ namespace antara::gaming::collisions {
         static bool query_point(transform::ts_rect box, transform::position_2d pos) noexcept;
 
         static bool query_point(entt::registry &registry, entt::entity entity, transform::position_2d pos) noexcept;
+
+        /**
+         * @brief continuous counterpart of query_rect: moving is translated by displacement, target stays still.
+         * @return the first time the boxes overlap during the displacement, std::nullopt if they never do
+         */
+        static std::optional<sweep_hit> sweep_rect(transform::ts_rect moving, math::vec2f displacement,
+                                                   transform::ts_rect target) noexcept;
+
+        /**
+         * @brief sweep the collision boxes of both entities over their last logic tick.
+         * @note only dynamic entities are considered moving, the displacement of the others is zero.
+         */
+        static std::optional<sweep_hit>
+        sweep_rect(entt::registry &registry, entt::entity moving, entt::entity target) noexcept;
+
+    private:
+        //! Private typedefs
+        struct candidate {
+            entt::entity entity{entt::null};
+            float min_x{0.f}; ///< bounds swept over the tick
+            float max_x{0.f};
+            float min_y{0.f};
+            float max_y{0.f};
+            transform::ts_rect bounds{}; ///< at the end of the tick
+            math::vec2f displacement{math::vec2f::scalar(0.f)};
+            collider filter;
+        };
+
+        //! Private fields
+        std::vector<candidate> candidates_;
+        pair_set previous_pairs_;
+        pair_set current_pairs_;
+        std::vector<pair_set::key_type> begins_;
+        std::vector<pair_set::key_type> ends_;
+        std::vector<contact> contacts_;
+        stats stats_;
+
+        //! Private member functions
+        void collect_candidates_() noexcept;
+
+        void find_pairs_() noexcept;
+
+        [[nodiscard]] bool test_pair_(const candidate &first, const candidate &second) noexcept;
+
+        void emit_events_() noexcept;
     };
 }
 
@@ -0,0 +1,52 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+#pragma once
+
+//! C System Headers
+#include <cstdint> ///< std::uint32_t
+
+//! SDK Headers
+#include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
+#include "antara/gaming/math/vector.hpp" ///< math::vec2f
+
+namespace antara::gaming::collisions {
+    /**
+     * @struct collider
+     * @brief Makes an entity take part in the collision pairs of the basic_collision_system.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         layer and mask are user-defined bitfields: layer holds the categories of the entity, mask the categories it collides with.
+     *         Two colliders interact only if each layer is in the mask of the other, other pairs are skipped before any bounds test.
+     *         With a null size the collider uses the global_bounds of its transform::properties, which are filled by the graphic system.
+     *         Otherwise its box has this size and is centered on its transform::position_2d: nothing has to draw the entity,
+     *         which is what a headless server needs.
+     * @endverbatim
+     */
+    struct collider {
+        //! Fields
+        std::uint32_t layer{1u};
+        std::uint32_t mask{0xFFFFFFFFu};
+        math::vec2f size{math::vec2f::scalar(0.f)};
+
+        /// @return true if the two colliders accept each other
+        [[nodiscard]] static constexpr bool can_interact(const collider &first, const collider &second) noexcept {
+            return (first.layer & second.mask) != 0u && (second.layer & first.mask) != 0u;
+        }
+    };
+}
+
+REFL_AUTO(type(antara::gaming::collisions::collider), field(layer), field(mask), field(size))
@@ -0,0 +1,50 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+#pragma once
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::entity
+
+//! SDK Headers
+#include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
+
+namespace antara::gaming::collisions::event {
+    /**
+     * @struct collision_begin
+     * @brief Emitted by the basic_collision_system on the tick two colliders start to overlap.
+     * @note first is the entity with the lowest identifier.
+     */
+    struct collision_begin {
+        //! Fields
+        entt::entity first{entt::null};
+        entt::entity second{entt::null};
+    };
+
+    /**
+     * @struct collision_end
+     * @brief Emitted by the basic_collision_system on the tick two colliders stop overlapping.
+     * @note one of the entities may have been destroyed since, check it with entt::registry::valid before using it.
+     */
+    struct collision_end {
+        //! Fields
+        entt::entity first{entt::null};
+        entt::entity second{entt::null};
+    };
+}
+
+REFL_AUTO(type(antara::gaming::collisions::event::collision_begin), field(first), field(second))
+
+REFL_AUTO(type(antara::gaming::collisions::event::collision_end), field(first), field(second))
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+//! C++ System Headers
+#include <algorithm> ///< std::fill
+#include <type_traits> ///< std::underlying_type_t
+
+//! SDK Headers
+#include "antara/gaming/collisions/pair.set.hpp"
+
+//! Anonymous Implementation
+namespace {
+    using entity_integral = std::underlying_type_t<entt::entity>;
+
+    std::size_t round_capacity(std::size_t capacity) noexcept {
+        std::size_t rounded = 8u;
+        while (rounded < capacity) {
+            rounded <<= 1u;
+        }
+        return rounded;
+    }
+
+    //! splitmix64 finalizer: entity identifiers are sequential, the low bits of the key alone would cluster
+    std::uint64_t mix(std::uint64_t key) noexcept {
+        key = (key ^ (key >> 30u)) * 0xBF58476D1CE4E5B9ull;
+        key = (key ^ (key >> 27u)) * 0x94D049BB133111EBull;
+        return key ^ (key >> 31u);
+    }
+}
+
+namespace antara::gaming::collisions {
+    pair_set::key_type pair_set::make_key(entt::entity first, entt::entity second) noexcept {
+        auto lhs = static_cast<key_type>(static_cast<entity_integral>(first));
+        auto rhs = static_cast<key_type>(static_cast<entity_integral>(second));
+        if (lhs > rhs) {
+            std::swap(lhs, rhs);
+        }
+        return (lhs << 32u) | rhs;
+    }
+
+    std::pair<entt::entity, entt::entity> pair_set::split_key(key_type key) noexcept {
+        return {static_cast<entt::entity>(static_cast<entity_integral>(key >> 32u)),
+                static_cast<entt::entity>(static_cast<entity_integral>(key & 0xFFFFFFFFull))};
+    }
+
+    pair_set::pair_set(std::size_t capacity) noexcept :
+            slots_(round_capacity(capacity), empty_key), mask_(slots_.size() - 1u) {
+    }
+
+    std::size_t pair_set::slot_of_(key_type key) const noexcept {
+        auto slot = static_cast<std::size_t>(mix(key)) & mask_;
+        while (slots_[slot] != empty_key && slots_[slot] != key) {
+            slot = (slot + 1u) & mask_;
+        }
+        return slot;
+    }
+
+    bool pair_set::insert(key_type key) noexcept {
+        if ((size_ + 1u) * 2u > slots_.size()) {
+            grow_();
+        }
+        const auto slot = slot_of_(key);
+        if (slots_[slot] == key) {
+            return false;
+        }
+        slots_[slot] = key;
+        ++size_;
+        return true;
+    }
+
+    bool pair_set::contains(key_type key) const noexcept {
+        return slots_[slot_of_(key)] == key;
+    }
+
+    void pair_set::clear() noexcept {
+        if (size_ != 0u) {
+            std::fill(slots_.begin(), slots_.end(), empty_key);
+            size_ = 0u;
+        }
+    }
+
+    std::size_t pair_set::size() const noexcept {
+        return size_;
+    }
+
+    bool pair_set::empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    std::size_t pair_set::capacity() const noexcept {
+        return slots_.size();
+    }
+
+    void pair_set::grow_() noexcept {
+        std::vector<key_type> old_slots(slots_.size() * 2u, empty_key);
+        old_slots.swap(slots_);
+        mask_ = slots_.size() - 1u;
+        for (auto &&key : old_slots) {
+            if (key != empty_key) {
+                slots_[slot_of_(key)] = key;
+            }
+        }
+    }
+}
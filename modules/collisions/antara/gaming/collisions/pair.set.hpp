@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <limits> ///< std::numeric_limits
+#include <utility> ///< std::pair
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::entity
+
+namespace antara::gaming::collisions {
+    /**
+     * @class pair_set
+     * @brief Open addressing hash set of unordered entity pairs, with linear probing over a power of two table.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         A pair is packed in a 64 bits key, identifiers with their version so a recycled entity is another pair.
+     *         The table is kept at most half full and grows by doubling, clear() keeps the capacity: a set reused every tick stops allocating.
+     * @endverbatim
+     */
+    class pair_set {
+    public:
+        //! Public typedefs
+        using key_type = std::uint64_t;
+
+        //! Public constants
+        static constexpr key_type empty_key = std::numeric_limits<key_type>::max();
+
+        //! Public static functions
+
+        /// @return the key of the pair, the same whatever the order of the entities
+        [[nodiscard]] static key_type make_key(entt::entity first, entt::entity second) noexcept;
+
+        /// @return the entities of the pair, lowest identifier first
+        [[nodiscard]] static std::pair<entt::entity, entt::entity> split_key(key_type key) noexcept;
+
+        //! Constructor
+
+        /// @param capacity initial number of slots, rounded up to a power of two
+        explicit pair_set(std::size_t capacity = 64u) noexcept;
+
+        //! Public member functions
+
+        /// @return true if the key was not in the set yet
+        bool insert(key_type key) noexcept;
+
+        [[nodiscard]] bool contains(key_type key) const noexcept;
+
+        void clear() noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        [[nodiscard]] bool empty() const noexcept;
+
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+        /// @brief call functor(key) for every key of the set, in no particular order.
+        template<typename TFunctor>
+        void for_each(TFunctor &&functor) const {
+            for (auto &&key : slots_) {
+                if (key != empty_key) {
+                    functor(key);
+                }
+            }
+        }
+
+    private:
+        //! Private fields
+        std::vector<key_type> slots_;
+        std::size_t mask_;
+        std::size_t size_{0u};
+
+        //! Private member functions
+        [[nodiscard]] std::size_t slot_of_(key_type key) const noexcept;
+
+        void grow_() noexcept;
+    };
+}
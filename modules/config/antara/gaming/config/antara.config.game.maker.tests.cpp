@@ -72,6 +72,7 @@ namespace antara::gaming::config::tests
   "window_height": 1081.0,
   "window_title": "tic-tac-toe",
   "vsync": false,
+  "threaded_rendering": false,
   "mouse_visible": true,
   "mouse_grabbed": false,
   "no_style": false,
@@ -51,6 +51,12 @@ namespace antara::gaming::graphics
             game_maker_cfg.vsync = false;
         }
 
+        if (json_data.find("threaded_rendering") != json_data.end()) {
+            json_data.at("threaded_rendering").get_to(game_maker_cfg.threaded_rendering);
+        } else {
+            game_maker_cfg.threaded_rendering = false;
+        }
+
         if (json_data.find("mouse_visible") != json_data.end()) {
             json_data.at("mouse_visible").get_to(game_maker_cfg.mouse_visible);
         } else {
@@ -85,6 +91,7 @@ namespace antara::gaming::graphics
         json_data["custom_canvas_width"] = game_maker_cfg.custom_canvas_width;
         json_data["custom_canvas_height"] = game_maker_cfg.custom_canvas_height;
         json_data["vsync"] = game_maker_cfg.vsync;
+        json_data["threaded_rendering"] = game_maker_cfg.threaded_rendering;
         json_data["mouse_visible"] = game_maker_cfg.mouse_visible;
         json_data["mouse_grabbed"] = game_maker_cfg.mouse_grabbed;
         json_data["no_style"] = game_maker_cfg.no_style;
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <cstring>
+#include <doctest/doctest.h>
+#include "antara/gaming/ecs/binary.snapshot.hpp"
+
+namespace antara::gaming::ecs::tests {
+    TEST_SUITE ("binary snapshot") {
+        TEST_CASE ("round trip") {
+            entt::registry registry;
+            auto first = registry.create();
+            registry.assign<transform::position_2d>(first, 1.f, 2.f);
+            registry.assign<graphics::layer_3>(first);
+            registry.assign<graphics::sprite>(first, graphics::sprite{"player.png", false, {{1.f, 2.f}, {3.f, 4.f}}});
+            auto second = registry.create();
+            registry.assign<transform::position_2d>(second, 3.f, 4.f);
+            graphics::text txt;
+            txt.contents = "score";
+            txt.appearance = "arial.ttf";
+            registry.assign<graphics::text>(second, txt);
+            geometry::vertex_array vertices;
+            vertices.vertices.resize(3);
+            vertices.vertices[1].pos = math::vec2f{5.f, 6.f};
+            registry.assign<geometry::vertex_array>(second, vertices);
+
+            auto snapshot = save_binary_snapshot(registry);
+            entt::registry restored;
+            auto result = load_binary_snapshot(restored, snapshot);
+            REQUIRE(result.has_value());
+                    CHECK_EQ(result.value(), 2u);
+                    CHECK_EQ(restored.size<transform::position_2d>(), 2u);
+                    CHECK_EQ(restored.size<graphics::layer_3>(), 1u);
+            restored.view<graphics::sprite>().each([](const graphics::sprite &spr) {
+                        CHECK_EQ(spr.appearance, "player.png");
+                        CHECK_FALSE(spr.native_size);
+                        CHECK_EQ(spr.texture_rec.size, math::vec2f{3.f, 4.f});
+            });
+            restored.view<graphics::text>().each([](const graphics::text &restored_txt) {
+                        CHECK_EQ(restored_txt.contents, "score");
+                        CHECK_EQ(std::strcmp(restored_txt.appearance, "arial.ttf"), 0);
+            });
+            restored.view<geometry::vertex_array>().each([](const geometry::vertex_array &restored_vertices) {
+                        REQUIRE_EQ(restored_vertices.vertices.size(), 3u);
+                        CHECK_EQ(restored_vertices.vertices[1].pos, math::vec2f{5.f, 6.f});
+            });
+        }
+
+        TEST_CASE ("errors") {
+            entt::registry registry;
+            registry.assign<transform::position_2d>(registry.create(), 1.f, 2.f);
+            auto snapshot = save_binary_snapshot(registry, doom::meta::list<transform::position_2d>{});
+            entt::registry restored;
+
+                    SUBCASE("not a snapshot") {
+                snapshot[0] = 'X';
+                        CHECK_EQ(load_binary_snapshot(restored, snapshot).error(),
+                                 std::make_error_code(std::errc::illegal_byte_sequence));
+            }
+                    SUBCASE("other version") {
+                snapshot[4] += 1u;
+                        CHECK_EQ(load_binary_snapshot(restored, snapshot).error(),
+                                 std::make_error_code(std::errc::not_supported));
+            }
+                    SUBCASE("truncated") {
+                snapshot.resize(snapshot.size() - 1u);
+                        CHECK_EQ(load_binary_snapshot(restored, snapshot).error(),
+                                 std::make_error_code(std::errc::result_out_of_range));
+                        CHECK_EQ(restored.alive(), 0u);
+            }
+                    SUBCASE("a failed load leaves the registry untouched") {
+                registry.assign<transform::properties>(registry.create());
+                using components = doom::meta::list<transform::position_2d, transform::properties>;
+                snapshot = save_binary_snapshot(registry, components{});
+                snapshot.resize(snapshot.size() - 1u);
+                auto existing = restored.create();
+                        CHECK_EQ(load_binary_snapshot(restored, snapshot, components{}).error(),
+                                 std::make_error_code(std::errc::result_out_of_range));
+                        CHECK_EQ(restored.alive(), 1u);
+                        CHECK(restored.valid(existing));
+                        CHECK(restored.empty<transform::position_2d>());
+            }
+                    SUBCASE("components missing from the list are skipped") {
+                auto result = load_binary_snapshot(restored, snapshot, doom::meta::list<transform::properties>{});
+                        REQUIRE(result.has_value());
+                        CHECK(restored.empty<transform::position_2d>());
+            }
+        }
+    }
+}
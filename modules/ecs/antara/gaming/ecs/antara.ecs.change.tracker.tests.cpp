@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <vector>
+#include <doctest/doctest.h>
+#include "antara/gaming/ecs/change.tracker.hpp"
+#include "antara/gaming/transform/component.position.hpp"
+
+namespace antara::gaming::ecs::tests {
+    TEST_SUITE ("change tracker") {
+        TEST_CASE ("constructions and replacements are recorded") {
+            entt::registry registry;
+            auto &tracker = registry.set<change_tracker>();
+            tracker.track<transform::position_2d>(registry);
+            auto first = registry.create();
+            auto second = registry.create();
+            registry.assign<transform::position_2d>(first, 1.f, 1.f);
+            registry.assign<transform::position_2d>(second, 2.f, 2.f);
+            const auto since = tracker.tick();
+                    CHECK(tracker.changed_since<transform::position_2d>(first, 0u));
+                    CHECK_FALSE(tracker.changed_since<transform::position_2d>(first, since));
+
+            registry.replace<transform::position_2d>(second, 3.f, 3.f);
+            std::vector<entt::entity> changed;
+            auto nb_changed = tracker.each_changed<transform::position_2d>(registry, since,
+                                                                           [&changed](entt::entity entity, transform::position_2d &pos) {
+                                                                               changed.push_back(entity);
+                                                                                       CHECK_EQ(pos.x(), 3.f);
+                                                                           });
+                    CHECK_EQ(nb_changed, 1u);
+                    REQUIRE_EQ(changed.size(), 1u);
+                    CHECK_EQ(changed[0], second);
+        }
+
+        TEST_CASE ("an entity changed several times is visited once") {
+            entt::registry registry;
+            auto &tracker = registry.set<change_tracker>();
+            tracker.track<transform::position_2d>(registry);
+            auto entity = registry.create();
+            registry.assign<transform::position_2d>(entity, 0.f, 0.f);
+            for (int i = 0; i < 500; ++i) {
+                registry.get<transform::position_2d>(entity).x() += 1.f;
+                tracker.mark_changed<transform::position_2d>(entity);
+            }
+                    CHECK_EQ(tracker.each_changed<transform::position_2d>(registry, 0u, [](auto, auto &) {}), 1u);
+                    CHECK_EQ(tracker.changed_at<transform::position_2d>(entity), tracker.tick());
+        }
+
+        TEST_CASE ("removed components and destroyed entities are skipped") {
+            entt::registry registry;
+            auto &tracker = registry.set<change_tracker>();
+            tracker.track<transform::position_2d>(registry);
+            auto removed = registry.create();
+            auto destroyed = registry.create();
+            registry.assign<transform::position_2d>(removed, 0.f, 0.f);
+            registry.assign<transform::position_2d>(destroyed, 0.f, 0.f);
+            registry.remove<transform::position_2d>(removed);
+            registry.destroy(destroyed);
+                    CHECK_EQ(tracker.each_changed<transform::position_2d>(registry, 0u, [](auto, auto &) {}), 0u);
+                    CHECK_EQ(tracker.changed_at<transform::properties>(removed), 0u);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include "antara/gaming/ecs/hierarchy.system.hpp"
+#include "antara/gaming/ecs/system.manager.hpp"
+
+namespace antara::gaming::ecs::tests
+{
+    TEST_SUITE ("hierarchy system")
+    {
+        TEST_CASE ("world transforms follow the parents")
+        {
+            entt::registry registry;
+            entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+            static_cast<void>(dispatcher);
+            system_manager manager{registry};
+            auto &hierarchy = manager.create_system<hierarchy_system>();
+
+            auto root = registry.create();
+            registry.assign<transform::position_2d>(root, 10.f, 0.f);
+            registry.assign<transform::properties>(root);
+            auto child = registry.create();
+            auto grand_child = registry.create();
+            //! the grand child is created first, the storage has to be sorted to compute its parent before it
+            registry.assign<transform::parent_2d>(grand_child, transform::parent_2d{child, math::vec2f{1.f, 0.f}});
+            registry.assign<transform::parent_2d>(child, transform::parent_2d{root, math::vec2f{5.f, 0.f}});
+            registry.assign<transform::properties>(child);
+
+            hierarchy.update();
+                    CHECK_EQ(hierarchy.nb_updated(), 2u);
+                    CHECK_EQ(registry.get<transform::position_2d>(child), math::vec2f{15.f, 0.f});
+                    CHECK_EQ(registry.get<transform::position_2d>(grand_child), math::vec2f{16.f, 0.f});
+                    CHECK_EQ(registry.get<transform::parent_2d>(grand_child).depth, 2u);
+
+            hierarchy.update();
+                    CHECK_EQ(hierarchy.nb_updated(), 0u);
+
+            auto props = registry.get<transform::properties>(root);
+            props.scale = math::vec2f{2.f, 2.f};
+            registry.replace<transform::properties>(root, props);
+            hierarchy.update();
+                    CHECK_EQ(hierarchy.nb_updated(), 2u);
+                    CHECK_EQ(registry.get<transform::position_2d>(child), math::vec2f{20.f, 0.f});
+                    CHECK_EQ(registry.get<transform::properties>(child).scale, math::vec2f{2.f, 2.f});
+                    CHECK_EQ(registry.get<transform::position_2d>(grand_child), math::vec2f{22.f, 0.f});
+        }
+
+        TEST_CASE ("only the dirty subtree is recomputed")
+        {
+            entt::registry registry;
+            entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+            static_cast<void>(dispatcher);
+            system_manager manager{registry};
+            auto &hierarchy = manager.create_system<hierarchy_system>();
+
+            auto first_root = registry.create();
+            registry.assign<transform::position_2d>(first_root, 0.f, 0.f);
+            auto second_root = registry.create();
+            registry.assign<transform::position_2d>(second_root, 0.f, 0.f);
+            for (auto root : {first_root, second_root}) {
+                for (int i = 0; i < 3; ++i) {
+                    registry.assign<transform::parent_2d>(registry.create(), transform::parent_2d{root, math::vec2f{1.f, 1.f}});
+                }
+            }
+            hierarchy.update();
+                    CHECK_EQ(hierarchy.nb_updated(), 6u);
+
+            registry.replace<transform::position_2d>(second_root, 4.f, 4.f);
+            hierarchy.update();
+                    CHECK_EQ(hierarchy.nb_updated(), 3u);
+
+            registry.get<transform::position_2d>(first_root).x_ref() = 2.f;
+            hierarchy.mark_dirty(first_root);
+            hierarchy.update();
+                    CHECK_EQ(hierarchy.nb_updated(), 3u);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include "antara/gaming/ecs/parallel.for.each.hpp"
+#include "antara/gaming/transform/component.position.hpp"
+
+namespace antara::gaming::ecs::tests {
+    TEST_SUITE ("parallel for each") {
+        TEST_CASE ("chunk size") {
+                    CHECK_EQ(chunk_size_for(10u, 8u, chunking{}), 1024u);
+                    CHECK_EQ(chunk_size_for(1'000'000u, 4u, chunking{}) % cache_line_size, 0u);
+                    CHECK_GE(chunk_size_for(1'000'000u, 4u, chunking{}) * 4u * 4u, 1'000'000u);
+        }
+
+        TEST_CASE ("every entity is visited once") {
+            entt::registry registry;
+            for (std::size_t i = 0u; i < 20'000u; ++i) {
+                registry.assign<transform::position_2d>(registry.create(), 1.f, 2.f);
+            }
+            worker_pool pool{3u};
+            auto view = registry.view<transform::position_2d>();
+            parallel_for_each(view, [&view](entt::entity entity) {
+                view.get(entity) += math::vec2f{1.f, 1.f};
+            }, pool, chunking{64u, 4u});
+            view.each([](const transform::position_2d &pos) {
+                        CHECK_EQ(pos, math::vec2f{2.f, 3.f});
+            });
+        }
+
+        TEST_CASE ("deterministic reduction") {
+            entt::registry registry;
+            for (std::size_t i = 0u; i < 10'000u; ++i) {
+                registry.assign<transform::position_2d>(registry.create(), 0.1f * i, 0.f);
+            }
+            auto view = registry.view<transform::position_2d>();
+            auto map = [&view](entt::entity entity) { return view.get(entity).x(); };
+            auto reduce = [](float lhs, float rhs) { return lhs + rhs; };
+            worker_pool serial{0u};
+            worker_pool parallel{3u};
+                    CHECK_EQ(parallel_reduce(view, 0.f, map, reduce, serial),
+                             parallel_reduce(view, 0.f, map, reduce, parallel));
+        }
+
+        TEST_CASE ("deferred structural changes") {
+            entt::registry registry;
+            for (std::size_t i = 0u; i < 5'000u; ++i) {
+                registry.assign<transform::position_2d>(registry.create(), 0.f, 0.f);
+            }
+            worker_pool pool{2u};
+            deferred_commands commands;
+            parallel_for_each(registry.view<transform::position_2d>(), commands,
+                              [](entt::entity entity, chunk_context &ctx) {
+                                  ctx.defer([entity](entt::registry &reg) { reg.destroy(entity); });
+                              }, pool);
+                    CHECK_EQ(commands.size(), 5'000u);
+                    CHECK_EQ(registry.size<transform::position_2d>(), 5'000u);
+            commands.flush(registry);
+                    CHECK(registry.empty<transform::position_2d>());
+        }
+
+        TEST_CASE ("deferred commands of several passes") {
+            entt::registry registry;
+            for (std::size_t i = 0u; i < 5'000u; ++i) {
+                registry.assign<transform::position_2d>(registry.create(), 0.f, 0.f);
+            }
+            worker_pool pool{2u};
+            deferred_commands commands;
+            std::size_t nb_applied = 0u;
+            auto count = [&nb_applied](entt::entity, chunk_context &ctx) {
+                ctx.defer([&nb_applied](entt::registry &) { ++nb_applied; });
+            };
+            parallel_for_each(registry.view<transform::position_2d>(), commands, count, pool);
+            parallel_for_each(registry.view<transform::position_2d>(), commands, count, pool);
+                    CHECK_EQ(commands.size(), 10'000u);
+            commands.flush(registry);
+                    CHECK_EQ(nb_applied, 10'000u);
+                    CHECK_EQ(commands.size(), 0u);
+            parallel_for_each(registry.view<transform::position_2d>(), commands, count, pool);
+            commands.flush(registry);
+                    CHECK_EQ(nb_applied, 15'000u);
+        }
+    }
+}
@@ -0,0 +1,136 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include <entt/entity/helper.hpp>
+#include "antara/gaming/ecs/interpolation.system.hpp"
+#include "antara/gaming/ecs/render.snapshot.hpp"
+#include "antara/gaming/ecs/system.manager.hpp"
+#include "antara/gaming/graphics/component.layer.hpp"
+#include "antara/gaming/transform/component.position.hpp"
+
+namespace antara::gaming::ecs::tests
+{
+    TEST_SUITE ("render snapshot")
+    {
+        TEST_CASE ("interpolated position")
+        {
+            render_snapshot::entry entry{entt::null, math::vec2f{10.f, 10.f}, math::vec2f{0.f, 0.f}, 0u, true};
+                    CHECK_EQ(entry.interpolated_position(0.5f), math::vec2f{5.f, 5.f});
+            entry.is_dynamic = false;
+                    CHECK_EQ(entry.interpolated_position(0.5f), math::vec2f{10.f, 10.f});
+        }
+
+        TEST_CASE ("double buffer")
+        {
+            render_snapshot_buffer buffer;
+            render_snapshot out;
+                    CHECK_FALSE(buffer.try_acquire(out));
+            buffer.back().frame_id = 42ull;
+            buffer.publish();
+                    CHECK(buffer.try_acquire(out));
+                    CHECK_EQ(out.frame_id, 42ull);
+                    CHECK_FALSE(buffer.try_acquire(out));
+            buffer.close();
+                    CHECK_FALSE(buffer.wait_acquire(out));
+        }
+
+        TEST_CASE ("system manager produce a snapshot")
+        {
+            entt::registry registry;
+            entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+            static_cast<void>(dispatcher);
+            auto &buffer = registry.set<render_snapshot_buffer>();
+            system_manager manager{registry};
+            auto entity = registry.create();
+            registry.assign<transform::position_2d>(entity, 1.f, 2.f);
+            registry.assign<graphics::layer_3>(entity);
+            registry.assign<entt::tag<"dynamic"_hs>>(entity);
+            manager.start();
+            manager.update();
+            render_snapshot out;
+                    CHECK(buffer.try_acquire(out));
+                    REQUIRE_EQ(out.entries.size(), 1u);
+                    CHECK_EQ(out.entries[0].entity, entity);
+                    CHECK_EQ(out.entries[0].layer, 3u);
+                    CHECK(out.entries[0].is_dynamic);
+        }
+
+        TEST_CASE ("drawables without position are part of the snapshot")
+        {
+            entt::registry registry;
+            entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+            static_cast<void>(dispatcher);
+            auto &buffer = registry.set<render_snapshot_buffer>();
+            system_manager manager{registry};
+            auto grid = registry.create();
+            registry.assign<graphics::layer_0>(grid);
+            registry.assign<entt::tag<"dynamic"_hs>>(grid);
+            manager.start();
+            manager.update();
+            render_snapshot out;
+                    REQUIRE(buffer.try_acquire(out));
+                    REQUIRE_EQ(out.entries.size(), 1u);
+                    CHECK_EQ(out.entries[0].entity, grid);
+                    CHECK_FALSE(out.entries[0].is_dynamic);
+                    CHECK_EQ(out.entries[0].interpolated_position(0.5f), math::vec2f::scalar(0.f));
+        }
+
+        TEST_CASE ("batched interpolation of dynamic entities")
+        {
+            entt::registry registry;
+            entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+            static_cast<void>(dispatcher);
+            system_manager manager{registry};
+            auto static_entity = registry.create();
+            registry.assign<transform::position_2d>(static_entity, 4.f, 4.f);
+            auto dynamic_entity = registry.create();
+            registry.assign<transform::position_2d>(dynamic_entity, 0.f, 0.f);
+            registry.assign<entt::tag<"dynamic"_hs>>(dynamic_entity);
+            registry.replace<transform::position_2d>(dynamic_entity, 10.f, 20.f);
+            interpolation_system::interpolate(registry, 0.5f);
+                    CHECK_EQ(registry.get<transform::interpolated_position_2d>(dynamic_entity), math::vec2f{5.f, 10.f});
+                    CHECK_FALSE(registry.has<transform::interpolated_position_2d>(static_entity));
+            manager.get_system<interpolation_system>().update();
+            interpolation_system::interpolate(registry, 0.5f);
+                    CHECK_EQ(registry.get<transform::interpolated_position_2d>(dynamic_entity), math::vec2f{10.f, 20.f});
+            registry.remove<entt::tag<"dynamic"_hs>>(dynamic_entity);
+                    CHECK_FALSE(registry.has<transform::interpolated_position_2d>(dynamic_entity));
+        }
+
+        TEST_CASE ("a static entity moved by hand is rendered at its new position")
+        {
+            entt::registry registry;
+            entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+            static_cast<void>(dispatcher);
+            auto &buffer = registry.set<render_snapshot_buffer>();
+            system_manager manager{registry};
+            auto static_entity = registry.create();
+            registry.assign<transform::position_2d>(static_entity, 4.f, 4.f);
+            registry.assign<graphics::layer_1>(static_entity);
+            manager.start();
+            manager.update();
+            registry.replace<transform::position_2d>(static_entity, 40.f, 8.f);
+            manager.update();
+            render_snapshot out;
+                    REQUIRE(buffer.try_acquire(out));
+                    REQUIRE_EQ(out.entries.size(), 1u);
+                    CHECK_FALSE(out.entries[0].is_dynamic);
+                    CHECK_EQ(out.entries[0].interpolated_position(out.interpolation), math::vec2f{40.f, 8.f});
+                    CHECK_FALSE(registry.has<transform::interpolated_position_2d>(static_entity));
+        }
+    }
+}
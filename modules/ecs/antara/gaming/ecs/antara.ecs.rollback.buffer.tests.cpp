@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include "antara/gaming/ecs/rollback.buffer.hpp"
+#include "antara/gaming/ecs/system.hpp"
+#include "antara/gaming/ecs/system.manager.hpp"
+
+namespace antara::gaming::ecs::tests
+{
+    struct counter
+    {
+        int value{0};
+    };
+
+    //! untracked input of the simulation
+    struct counter_step
+    {
+        int value{1};
+    };
+
+    class counter_system final : public logic_update_system<counter_system>
+    {
+    public:
+        counter_system(entt::registry &registry) noexcept : system(registry)
+        {
+
+        }
+
+        void update() noexcept final
+        {
+            const auto step = entity_registry_.ctx<counter_step>().value;
+            entity_registry_.view<counter>().each([step](counter &cnt) { cnt.value += step; });
+        }
+
+        ~counter_system() noexcept final = default;
+    };
+}
+
+REFL_AUTO(type(antara::gaming::ecs::tests::counter_system))
+
+namespace antara::gaming::ecs::tests
+{
+    TEST_SUITE ("rollback buffer")
+    {
+        TEST_CASE ("restore a captured tick")
+        {
+            entt::registry registry;
+            rollback_buffer rollback{4u};
+            rollback.track<counter>();
+            auto entity = registry.create();
+            registry.assign<counter>(entity);
+            for (std::uint64_t tick = 0u; tick < 3u; ++tick) {
+                registry.get<counter>(entity).value = static_cast<int>(tick);
+                rollback.capture(registry, tick);
+            }
+                    CHECK_EQ(rollback.oldest_tick(), 0u);
+                    CHECK_EQ(rollback.newest_tick(), 2u);
+                    CHECK(rollback.restore(registry, 1u));
+                    CHECK_EQ(registry.get<counter>(entity).value, 1);
+                    CHECK_EQ(rollback.newest_tick(), 1u);
+                    CHECK_FALSE(rollback.contains(2u));
+        }
+
+        TEST_CASE ("added and removed components are rolled back")
+        {
+            entt::registry registry;
+            rollback_buffer rollback{4u};
+            rollback.track<counter>();
+            auto first = registry.create();
+            auto second = registry.create();
+            registry.assign<counter>(first, 1);
+            rollback.capture(registry, 0u);
+            registry.remove<counter>(first);
+            registry.assign<counter>(second, 2);
+            rollback.capture(registry, 1u);
+                    REQUIRE(rollback.restore(registry, 0u));
+                    CHECK(registry.has<counter>(first));
+                    CHECK_EQ(registry.get<counter>(first).value, 1);
+                    CHECK_FALSE(registry.has<counter>(second));
+        }
+
+        TEST_CASE ("memory is bounded by the capacity")
+        {
+            entt::registry registry;
+            rollback_buffer rollback{2u};
+            rollback.track<counter>();
+            auto entity = registry.create();
+            registry.assign<counter>(entity);
+            for (std::uint64_t tick = 0u; tick < 10u; ++tick) {
+                registry.get<counter>(entity).value = static_cast<int>(tick);
+                rollback.capture(registry, tick);
+            }
+                    CHECK_EQ(rollback.oldest_tick(), 7u);
+                    CHECK_EQ(rollback.newest_tick(), 9u);
+                    CHECK_FALSE(rollback.restore(registry, 6u));
+                    CHECK(rollback.restore(registry, 7u));
+                    CHECK_EQ(registry.get<counter>(entity).value, 7);
+        }
+
+        TEST_CASE ("system manager resimulate from a past tick")
+        {
+            entt::registry registry;
+            entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+            static_cast<void>(dispatcher);
+            auto &rollback = registry.set<rollback_buffer>(8u);
+            rollback.track<counter>();
+            registry.set<counter_step>();
+            system_manager manager{registry};
+            manager.create_system<counter_system>();
+            auto entity = registry.create();
+            registry.assign<counter>(entity);
+            manager.start();
+            while (manager.get_logic_tick() < 3u) {
+                manager.update();
+            }
+            const auto present = manager.get_logic_tick();
+                    CHECK_EQ(registry.get<counter>(entity).value, static_cast<int>(present));
+                    CHECK_EQ(rollback.newest_tick(), present);
+
+            //! a late input changes the simulation from tick 1
+            registry.ctx<counter_step>().value = 2;
+                    CHECK_EQ(manager.resimulate_from(1u), present - 1u);
+                    CHECK_EQ(registry.get<counter>(entity).value, static_cast<int>(1u + 2u * (present - 1u)));
+                    CHECK_EQ(manager.get_logic_tick(), present);
+                    CHECK_EQ(manager.resimulate_from(present + 1u), 0u);
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include "antara/gaming/ecs/static.system.pipeline.hpp"
+
+namespace antara::gaming::ecs::tests {
+    template<typename TSystemType>
+    class counting_system final : public system<counting_system<TSystemType>, TSystemType> {
+    public:
+        counting_system(entt::registry &registry) noexcept : system<counting_system<TSystemType>, TSystemType>(registry) {
+
+        }
+
+        void update() noexcept final {
+            nb_updates += 1;
+        }
+
+        void post_update() noexcept final {
+            nb_post_updates += 1;
+        }
+
+        ~counting_system() noexcept final = default;
+
+        std::size_t nb_updates{0u};
+        std::size_t nb_post_updates{0u};
+    };
+
+    using pre_counting_system = counting_system<st_system_pre_update>;
+    using logic_counting_system = counting_system<st_system_logic_update>;
+    using post_counting_system = counting_system<st_system_post_update>;
+}
+
+REFL_AUTO(template((typename TSystemType), (antara::gaming::ecs::tests::counting_system<TSystemType>)))
+
+namespace antara::gaming::ecs::tests {
+    TEST_CASE ("static system pipeline") {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        using pipeline_t = static_system_pipeline<post_counting_system, pre_counting_system, logic_counting_system>;
+        pipeline_t pipeline{registry};
+
+        static_assert(pipeline_t::nb_systems() == 3u);
+        static_assert(pipeline_t::nb_systems(system_type::logic_update) == 1u);
+        static_assert(pipeline_t::has_system<pre_counting_system>());
+        static_assert(not pipeline_t::has_system<interpolation_system>());
+
+                SUBCASE("update by phase") {
+                    CHECK_EQ(pipeline.update_systems<system_type::pre_update>(), 1u);
+                    CHECK_EQ(pipeline.update_systems<system_type::logic_update>(), 1u);
+                    CHECK_EQ(pipeline.get_system<pre_counting_system>().nb_updates, 1u);
+                    CHECK_EQ(pipeline.get_system<logic_counting_system>().nb_updates, 1u);
+                    CHECK_EQ(pipeline.get_system<post_counting_system>().nb_updates, 0u);
+        }
+
+                SUBCASE("runtime enable/disable") {
+            pipeline.disable_system<pre_counting_system>();
+                    CHECK_EQ(pipeline.update_systems<system_type::pre_update>(), 0u);
+                    CHECK_EQ(pipeline.get_system<pre_counting_system>().nb_updates, 0u);
+            pipeline.enable_system<pre_counting_system>();
+                    CHECK_EQ(pipeline.update_systems<system_type::pre_update>(), 1u);
+        }
+
+                SUBCASE("full update") {
+                    CHECK_EQ(pipeline.update(), 0u);
+            pipeline.start();
+            pipeline.update();
+            auto &&[pre, post] = pipeline.get_systems<pre_counting_system, post_counting_system>();
+                    CHECK_EQ(pre.nb_updates, 1u);
+                    CHECK_EQ(post.nb_updates, 1u);
+                    CHECK_EQ(pre.nb_post_updates, 1u);
+                    CHECK_EQ(post.nb_post_updates, 1u);
+        }
+
+                SUBCASE("tick divisor and substeps") {
+            auto &logic = pipeline.get_system<logic_counting_system>();
+            logic.set_tick_divisor(3u);
+            auto &timestep = registry.ctx<timer::time_step>();
+            timestep.set_clock_source(timer::clock_source::virtual_time);
+            pipeline.start();
+            for (std::size_t i = 0u; i < 9u; ++i) {
+                pipeline.update();
+            }
+                    CHECK_EQ(pipeline.get_logic_tick(), 9u);
+                    CHECK_EQ(logic.nb_updates, 3u);
+                    CHECK(logic.has_tick_phase());
+            logic.set_tick_rate(2.f / timer::time_step::get_fixed_delta_time());
+                    CHECK_EQ(logic.get_nb_substeps(), 2u);
+            pipeline.update();
+                    CHECK_EQ(logic.nb_updates, 5u);
+            timestep.set_clock_source(timer::clock_source::steady);
+        }
+
+                SUBCASE("registry wiring shared with the system manager") {
+                    CHECK_NE(registry.try_ctx<timer::time_step>(), nullptr);
+            auto entity = registry.create();
+            registry.assign<transform::position_2d>(entity, 1.f, 2.f);
+            registry.assign<graphics::layer_2>(entity);
+                    CHECK(registry.has<transform::previous_position_2d>(entity));
+                    REQUIRE(registry.has<graphics::draw_order>(entity));
+                    CHECK_EQ(registry.get<graphics::draw_order>(entity).layer, 2u);
+        }
+
+                SUBCASE("interpolation factor and render snapshot") {
+                    CHECK_NE(registry.try_ctx<interpolation_system::st_interpolation>(), nullptr);
+            auto &buffer = registry.set<render_snapshot_buffer>();
+            auto entity = registry.create();
+            registry.assign<transform::position_2d>(entity, 1.f, 2.f);
+            registry.assign<graphics::layer_1>(entity);
+            pipeline.start();
+            pipeline.update();
+            render_snapshot out;
+                    CHECK(buffer.try_acquire(out));
+                    REQUIRE_EQ(out.entries.size(), 1u);
+                    CHECK_EQ(out.entries[0].entity, entity);
+                    CHECK_EQ(out.entries[0].layer, 1u);
+        }
+    }
+}
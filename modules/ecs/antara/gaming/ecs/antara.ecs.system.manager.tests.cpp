@@ -14,10 +14,17 @@
  *                                                                            *
  ******************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <string>
 #include <doctest/doctest.h>
+#include "antara/gaming/ecs/interpolation.system.hpp"
 #include "antara/gaming/ecs/lambda.system.hpp"
 #include "antara/gaming/ecs/system.hpp"
 #include "antara/gaming/ecs/system.manager.hpp"
+#include "antara/gaming/event/quit.game.hpp"
+#include "antara/gaming/transform/component.position.hpp"
+#include "antara/gaming/transform/component.properties.hpp"
 
 class logic_concrete_system final : public antara::gaming::ecs::logic_update_system<logic_concrete_system> {
 public:
@@ -48,8 +55,170 @@ public:
     ~pre_concrete_system() noexcept final = default;
 };
 
+struct velocity {
+    float x;
+    float y;
+};
+
+class partial_group_system final : public antara::gaming::ecs::logic_update_system<partial_group_system> {
+public:
+    using velocity_group = antara::gaming::ecs::group_declaration<
+            doom::meta::list<velocity>, doom::meta::list<antara::gaming::transform::position_2d>>;
+    using owned_groups = doom::meta::list<velocity_group>;
+
+    partial_group_system(entt::registry &registry) noexcept : system(registry) {
+
+    }
+
+    void update() noexcept final {
+
+    }
+
+    ~partial_group_system() noexcept final = default;
+};
+
+class conflicting_group_system final : public antara::gaming::ecs::logic_update_system<conflicting_group_system> {
+public:
+    using owned_groups = doom::meta::list<antara::gaming::ecs::group_declaration<
+            doom::meta::list<antara::gaming::transform::position_2d, velocity>>>;
+
+    conflicting_group_system(entt::registry &registry) noexcept : system(registry) {
+
+    }
+
+    void update() noexcept final {
+
+    }
+
+    ~conflicting_group_system() noexcept final = default;
+};
+
+class nested_group_system final : public antara::gaming::ecs::logic_update_system<nested_group_system> {
+public:
+    //! dynamic_group of the interpolation_system, restricted to the entities with properties
+    using dynamic_properties_group = antara::gaming::ecs::group_declaration<
+            doom::meta::list<antara::gaming::transform::position_2d, antara::gaming::transform::previous_position_2d,
+                    antara::gaming::transform::interpolated_position_2d>,
+            doom::meta::list<entt::tag<"dynamic"_hs>, antara::gaming::transform::properties>>;
+    using owned_groups = doom::meta::list<dynamic_properties_group>;
+
+    nested_group_system(entt::registry &registry) noexcept : system(registry) {
+
+    }
+
+    void update() noexcept final {
+
+    }
+
+    ~nested_group_system() noexcept final = default;
+};
+
+class event_driven_system final : public antara::gaming::ecs::pre_update_system<event_driven_system> {
+public:
+    using wake_on_events = doom::meta::list<antara::gaming::event::quit_game>;
+    using wake_on_components = doom::meta::list<velocity>;
+
+    event_driven_system(entt::registry &registry) noexcept : system(registry) {
+
+    }
+
+    void update() noexcept final {
+        ++nb_updates;
+    }
+
+    ~event_driven_system() noexcept final = default;
+
+    std::size_t nb_updates{0u};
+};
+
+class ai_system final : public antara::gaming::ecs::logic_update_system<ai_system> {
+public:
+    ai_system(entt::registry &registry) noexcept : system(registry) {
+        this->set_tick_divisor(4u);
+    }
+
+    void update() noexcept final {
+        ++nb_updates;
+    }
+
+    ~ai_system() noexcept final = default;
+
+    std::size_t nb_updates{0u};
+};
+
+class economy_system final : public antara::gaming::ecs::logic_update_system<economy_system> {
+public:
+    economy_system(entt::registry &registry) noexcept : system(registry) {
+        this->set_tick_divisor(4u);
+    }
+
+    void update() noexcept final {
+        ++nb_updates;
+    }
+
+    ~economy_system() noexcept final = default;
+
+    std::size_t nb_updates{0u};
+};
+
+class movement_system final : public antara::gaming::ecs::logic_update_system<movement_system> {
+public:
+    movement_system(entt::registry &registry) noexcept : system(registry) {
+        this->set_tick_rate(120.f);
+    }
+
+    void update() noexcept final {
+        ++nb_updates;
+    }
+
+    ~movement_system() noexcept final = default;
+
+    std::size_t nb_updates{0u};
+};
+
+class lazy_system final : public antara::gaming::ecs::post_update_system<lazy_system> {
+public:
+    lazy_system(entt::registry &registry, std::size_t &nb_constructions, std::string name) noexcept :
+            system(registry), name(std::move(name)) {
+        ++nb_constructions;
+    }
+
+    void update() noexcept final {
+    }
+
+    ~lazy_system() noexcept final = default;
+
+    std::string name;
+};
+
+class enabling_system final : public antara::gaming::ecs::pre_update_system<enabling_system> {
+public:
+    enabling_system(entt::registry &registry, antara::gaming::ecs::system_manager &manager) noexcept :
+            system(registry), manager_(manager) {
+    }
+
+    void update() noexcept final {
+        enabled = manager_.enable_system<lazy_system>();
+    }
+
+    ~enabling_system() noexcept final = default;
+
+    bool enabled{false};
+private:
+    antara::gaming::ecs::system_manager &manager_;
+};
+
 REFL_AUTO(type(logic_concrete_system))
+REFL_AUTO(type(ai_system))
+REFL_AUTO(type(lazy_system))
+REFL_AUTO(type(enabling_system))
+REFL_AUTO(type(economy_system))
+REFL_AUTO(type(movement_system))
+REFL_AUTO(type(event_driven_system))
 REFL_AUTO(type(pre_concrete_system))
+REFL_AUTO(type(partial_group_system))
+REFL_AUTO(type(conflicting_group_system))
+REFL_AUTO(type(nested_group_system))
 
 namespace antara::gaming::ecs::tests {
     TEST_CASE ("add system") {
@@ -148,4 +317,247 @@ namespace antara::gaming::ecs::tests {
                 CHECK_GE(manager.update(), 1ull);
                 CHECK_EQ(2ull, manager.nb_systems());
     }
-}
\ No newline at end of file
+
+    struct fatal_error_counter {
+        std::size_t nb_errors{0u};
+
+        void on_fatal_error(const antara::gaming::event::fatal_error &) noexcept {
+            nb_errors += 1;
+        }
+    };
+
+    TEST_CASE ("declared owning groups") {
+        entt::registry registry;
+        entt::dispatcher &dispatcher{registry.set<entt::dispatcher>()};
+        fatal_error_counter counter;
+        dispatcher.sink<antara::gaming::event::fatal_error>().connect<&fatal_error_counter::on_fatal_error>(counter);
+        system_manager manager{registry};
+
+        manager.create_system<partial_group_system>();
+                CHECK_EQ(counter.nb_errors, 0u);
+        auto entity = registry.create();
+        registry.assign<transform::position_2d>(entity, 1.f, 2.f);
+        registry.assign<velocity>(entity, 3.f, 4.f);
+        auto group = partial_group_system::velocity_group::get(registry);
+                CHECK_EQ(group.size(), 1u);
+
+        //! nested in the interpolation_system group, which owns the same pools
+        manager.create_system<nested_group_system>();
+                CHECK_EQ(counter.nb_errors, 0u);
+        registry.assign<entt::tag<"dynamic"_hs>>(entity);
+                CHECK_EQ(nested_group_system::dynamic_properties_group::get(registry).size(), 0u);
+        registry.assign<transform::properties>(entity);
+                CHECK_EQ(nested_group_system::dynamic_properties_group::get(registry).size(), 1u);
+                CHECK_EQ(interpolation_system::dynamic_group::get(registry).size(), 1u);
+
+        //! position_2d is already owned by the interpolation_system group, which doesn't own velocity
+        manager.create_system<conflicting_group_system>();
+                CHECK_EQ(counter.nb_errors, 1u);
+    }
+
+    struct quit_game_listener {
+        int sum{0};
+
+        void on_quit_game(antara::gaming::event::event_span<antara::gaming::event::quit_game> events) noexcept {
+            for (auto &&evt : events) {
+                sum += evt.return_value_;
+            }
+        }
+    };
+
+    TEST_CASE ("queued events are drained by the update") {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        auto &bus = registry.set<antara::gaming::event::event_bus>();
+        quit_game_listener listener;
+        bus.connect<antara::gaming::event::quit_game, &quit_game_listener::on_quit_game>(listener);
+        system_manager manager{registry};
+        manager.start();
+        bus.enqueue<antara::gaming::event::quit_game>(2);
+        bus.enqueue<antara::gaming::event::quit_game>(3);
+                CHECK_EQ(listener.sum, 0);
+        manager.update();
+                CHECK_EQ(listener.sum, 5);
+    }
+
+    TEST_CASE ("sleeping systems are skipped until a wake condition fires") {
+        entt::registry registry;
+        auto &dispatcher = registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        auto &sys = manager.create_system<event_driven_system>();
+                CHECK(sys.is_event_driven());
+                CHECK(sys.is_sleeping());
+        manager.start();
+        manager.update();
+                CHECK_EQ(sys.nb_updates, 0u);
+                CHECK_EQ(manager.get_update_stats().nb_sleeping, 1u);
+
+        dispatcher.trigger<antara::gaming::event::quit_game>(0);
+        manager.update();
+        manager.update();
+                CHECK_EQ(sys.nb_updates, 1u);
+
+        auto entity = registry.create();
+        registry.assign<velocity>(entity, 1.f, 1.f);
+        manager.update();
+                CHECK_EQ(sys.nb_updates, 2u);
+
+        //! the wake conditions are disconnected along with the system
+        manager.mark_system<event_driven_system>();
+        manager.update();
+                CHECK_FALSE(manager.has_system<event_driven_system>());
+        dispatcher.trigger<antara::gaming::event::quit_game>(0);
+        registry.replace<velocity>(entity, 2.f, 2.f);
+    }
+
+    TEST_CASE ("systems sleeping on a timer") {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        auto &sys = manager.create_system<pre_concrete_system>();
+        manager.start();
+        sys.sleep();
+        manager.update();
+                CHECK_EQ(manager.get_update_stats().nb_sleeping, 1u);
+        sys.sleep_for(std::chrono::milliseconds(0));
+        manager.update();
+                CHECK_FALSE(sys.is_sleeping());
+                CHECK_EQ(manager.get_update_stats().nb_sleeping, 0u);
+        sys.sleep_for(std::chrono::hours(1));
+                CHECK_FALSE(sys.try_wake_up());
+        sys.wake_up();
+                CHECK(sys.try_wake_up());
+    }
+
+    TEST_CASE ("sleep delays are counted in game time") {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        auto &timestep = registry.ctx<antara::gaming::timer::time_step>();
+        timestep.set_clock_source(antara::gaming::timer::clock_source::virtual_time);
+        auto &sys = manager.create_system<pre_concrete_system>();
+        manager.start();
+        //! one logic tick per frame with the virtual clock, whatever the wall clock time
+        sys.sleep_for(2 * antara::gaming::timer::_60tps_dt);
+        manager.update();
+        manager.update();
+                CHECK(sys.is_sleeping());
+                CHECK_EQ(timestep.get_game_time(), 2 * antara::gaming::timer::_60tps_dt);
+        manager.update();
+                CHECK_FALSE(sys.is_sleeping());
+    }
+
+    TEST_CASE ("frames are recorded when a frame recorder is in the context") {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        auto &recorder = registry.set<antara::gaming::timer::frame_recorder>();
+        system_manager manager{registry};
+        manager.start();
+        manager.update();
+        manager.update();
+                CHECK_EQ(recorder.nb_frames(), 2u);
+                CHECK_EQ(recorder.window_size(), 2u);
+    }
+
+    TEST_CASE ("a virtual clock runs exactly one logic tick per update") {
+        using antara::gaming::timer::time_step;
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        manager.create_system<logic_concrete_system>();
+        manager.start();
+        registry.ctx<time_step>().set_clock_source(antara::gaming::timer::clock_source::virtual_time);
+        const auto first_tick = manager.get_logic_tick();
+        for (int i = 0; i < 100; ++i) {
+            manager.update();
+        }
+                CHECK_EQ(manager.get_logic_tick() - first_tick, 100u);
+    }
+
+    TEST_CASE ("systems run at their own rate with staggered phases") {
+        using antara::gaming::timer::time_step;
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        auto &ai = manager.create_system<ai_system>();
+        auto &economy = manager.create_system<economy_system>();
+        auto &movement = manager.create_system<movement_system>();
+                CHECK_EQ(movement.get_nb_substeps(), 2u);
+                CHECK_EQ(movement.get_fixed_delta_time(), doctest::Approx(time_step::get_fixed_delta_time() / 2.f));
+                CHECK_EQ(ai.get_fixed_delta_time(), doctest::Approx(time_step::get_fixed_delta_time() * 4.f));
+        manager.start();
+        registry.ctx<time_step>().set_clock_source(antara::gaming::timer::clock_source::virtual_time);
+        std::size_t nb_ticks_both_updated = 0u;
+        for (int i = 0; i < 8; ++i) {
+            const auto ai_updates = ai.nb_updates;
+            const auto economy_updates = economy.nb_updates;
+            manager.update();
+            if (ai.nb_updates != ai_updates && economy.nb_updates != economy_updates) {
+                ++nb_ticks_both_updated;
+            }
+        }
+                CHECK_EQ(ai.nb_updates, 2u);
+                CHECK_EQ(economy.nb_updates, 2u);
+                CHECK_EQ(nb_ticks_both_updated, 0u);
+                CHECK_NE(ai.get_tick_phase(), economy.get_tick_phase());
+                CHECK_EQ(movement.nb_updates, 16u);
+    }
+
+    TEST_CASE ("deferred systems are constructed on first enable") {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        std::size_t nb_constructions = 0u;
+        manager.defer_system<lazy_system>(std::ref(nb_constructions), std::string("minimap"));
+                CHECK(manager.is_system_deferred<lazy_system>());
+                CHECK_FALSE(manager.has_system<lazy_system>());
+                CHECK_EQ(nb_constructions, 0u);
+        manager.start();
+        manager.update();
+                CHECK_EQ(nb_constructions, 0u);
+                CHECK(manager.enable_system<lazy_system>());
+                CHECK_EQ(nb_constructions, 1u);
+                CHECK_FALSE(manager.is_system_deferred<lazy_system>());
+                CHECK_FALSE(manager.has_system<lazy_system>());
+        manager.update();
+                CHECK_EQ(manager.get_system<lazy_system>().name, "minimap");
+                CHECK(manager.enable_system<lazy_system>());
+                CHECK_EQ(nb_constructions, 1u);
+        manager.defer_system<lazy_system>(std::ref(nb_constructions), std::string("ignored"));
+                CHECK_FALSE(manager.is_system_deferred<lazy_system>());
+    }
+
+    TEST_CASE ("deferred systems enabled from inside an update") {
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        std::size_t nb_constructions = 0u;
+        manager.defer_system<lazy_system>(std::ref(nb_constructions), std::string("minimap"));
+        auto &enabling = manager.create_system<enabling_system>(manager);
+        manager.start();
+        manager.update();
+                CHECK(enabling.enabled);
+                CHECK_EQ(nb_constructions, 1u);
+                CHECK(manager.has_system<lazy_system>());
+                CHECK(manager.get_system<lazy_system>().is_enabled());
+        manager.update();
+                CHECK_EQ(nb_constructions, 1u);
+    }
+
+    TEST_CASE ("system constructions are traced until the first frame") {
+        auto &trace = antara::gaming::timer::startup_trace::shared();
+        trace.restart();
+        entt::registry registry;
+        registry.set<entt::dispatcher>();
+        system_manager manager{registry};
+        manager.create_system<logic_concrete_system>();
+        const auto entries = trace.get_entries();
+                CHECK(std::any_of(entries.begin(), entries.end(), [](auto &&entry) {
+                    return entry.name == "system" && entry.detail == logic_concrete_system::get_class_name();
+                }));
+        manager.start();
+        manager.update();
+                CHECK_FALSE(trace.is_recording());
+                CHECK_GT(trace.get_time_to_first_frame().count(), 0);
+    }
+}
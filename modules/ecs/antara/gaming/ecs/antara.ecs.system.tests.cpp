@@ -208,6 +208,12 @@ namespace antara::gaming::ecs::tests
 
                     SUBCASE ("system name") {
                         CHECK_EQ(dummy_system.get_name(), "antara::gaming::ecs::tests::logic_concrete_system");
+            }
+
+                    SUBCASE ("system id") {
+                        CHECK_EQ(dummy_system.get_system_id_rtti(), logic_concrete_system::get_system_id());
+                        CHECK_NE(logic_concrete_system::get_system_id(), pre_concrete_system::get_system_id());
+                        CHECK_NE(pre_concrete_system::get_system_id(), post_concrete_system::get_system_id());
             }
         }
     }
@@ -0,0 +1,157 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <chrono>
+#include <map>
+#include <vector>
+#include <doctest/doctest.h>
+#include "antara/gaming/ecs/time.slicer.hpp"
+
+namespace antara::gaming::ecs::tests
+{
+    struct visibility {
+        int nb_refresh{0};
+    };
+
+    struct sight {
+        float range{1.f};
+    };
+
+    TEST_SUITE ("time slicer")
+    {
+        TEST_CASE ("entity budget spread a sweep over several ticks")
+        {
+            entt::registry registry;
+            for (int i = 0; i < 10; ++i) {
+                registry.assign<visibility>(registry.create());
+            }
+            time_slicer slicer{4u};
+            auto refresh = [](entt::entity, visibility &vis) { ++vis.nb_refresh; };
+                    CHECK_EQ(slicer.process<visibility>(registry, refresh), 4u);
+                    CHECK(slicer.is_sweeping());
+                    CHECK_EQ(slicer.process<visibility>(registry, refresh), 4u);
+                    CHECK_EQ(slicer.process<visibility>(registry, refresh), 2u);
+                    CHECK_FALSE(slicer.is_sweeping());
+                    CHECK_EQ(slicer.get_last_sweep_ticks(), 3u);
+                    CHECK_EQ(slicer.get_nb_sweeps(), 1u);
+            auto view = registry.view<visibility>();
+            for (std::size_t idx = 0; idx < view.size(); ++idx) {
+                        CHECK_EQ(registry.get<visibility>(view.data()[idx]).nb_refresh, 1);
+            }
+        }
+
+        TEST_CASE ("entities created or destroyed between slices")
+        {
+            entt::registry registry;
+            std::vector<entt::entity> entities;
+            for (int i = 0; i < 10; ++i) {
+                entities.push_back(registry.create());
+                registry.assign<visibility>(entities.back());
+            }
+            time_slicer slicer{4u};
+            std::map<entt::entity, int> nb_processed;
+            auto refresh = [&nb_processed](entt::entity entity, visibility &) { ++nb_processed[entity]; };
+            slicer.process<visibility>(registry, refresh);
+            registry.destroy(entities[0]);
+            registry.destroy(entities[1]);
+            auto late_entity = registry.create();
+            registry.assign<visibility>(late_entity);
+            while (slicer.is_sweeping()) {
+                slicer.process<visibility>(registry, refresh);
+            }
+                    CHECK_FALSE(slicer.is_sweeping());
+                    CHECK_EQ(nb_processed.count(late_entity), 0u);
+            for (std::size_t idx = 2; idx < entities.size(); ++idx) {
+                        CHECK_EQ(nb_processed[entities[idx]], 1);
+            }
+            slicer.reset();
+            nb_processed.clear();
+            time_slicer full_sweep;
+                    CHECK_EQ(full_sweep.process<visibility>(registry, refresh), 9u);
+                    CHECK_EQ(full_sweep.get_last_sweep_ticks(), 1u);
+                    CHECK_EQ(nb_processed.count(late_entity), 1u);
+        }
+
+        TEST_CASE ("entities missing a component are skipped")
+        {
+            entt::registry registry;
+            for (int i = 0; i < 6; ++i) {
+                auto entity = registry.create();
+                registry.assign<visibility>(entity);
+                if (i % 2 == 0) {
+                    registry.assign<sight>(entity);
+                }
+            }
+            time_slicer slicer;
+            std::size_t nb_seen = 0u;
+            slicer.process<visibility, sight>(registry, [&nb_seen](entt::entity, visibility &, sight &) { ++nb_seen; });
+                    CHECK_EQ(nb_seen, 3u);
+        }
+
+        TEST_CASE ("entities sorted between slices are processed once")
+        {
+            entt::registry registry;
+            std::vector<entt::entity> entities;
+            for (int i = 0; i < 10; ++i) {
+                entities.push_back(registry.create());
+                registry.assign<visibility>(entities.back());
+            }
+            time_slicer slicer{3u};
+            std::map<entt::entity, int> nb_processed;
+            auto refresh = [&nb_processed](entt::entity entity, visibility &) { ++nb_processed[entity]; };
+            slicer.process<visibility>(registry, refresh);
+            registry.sort<visibility>([](const entt::entity lhs, const entt::entity rhs) { return lhs > rhs; });
+            while (slicer.is_sweeping()) {
+                slicer.process<visibility>(registry, refresh);
+            }
+            for (auto &&entity : entities) {
+                        CHECK_EQ(nb_processed[entity], 1);
+            }
+        }
+
+        TEST_CASE ("entities missing a component count toward the budget")
+        {
+            entt::registry registry;
+            for (int i = 0; i < 8; ++i) {
+                auto entity = registry.create();
+                registry.assign<visibility>(entity);
+                if (i == 0) {
+                    registry.assign<sight>(entity);
+                }
+            }
+            time_slicer slicer{4u};
+            auto noop = [](entt::entity, visibility &, sight &) {};
+                    CHECK_EQ(slicer.process<visibility, sight>(registry, noop), 0u);
+                    CHECK_EQ(slicer.get_cursor(), 4u);
+                    CHECK_EQ(slicer.process<visibility, sight>(registry, noop), 1u);
+                    CHECK_FALSE(slicer.is_sweeping());
+        }
+
+        TEST_CASE ("time budget")
+        {
+            entt::registry registry;
+            for (int i = 0; i < 64; ++i) {
+                registry.assign<visibility>(registry.create());
+            }
+            time_slicer slicer{0u, std::chrono::nanoseconds(1)};
+            auto nb_processed = slicer.process<visibility>(registry, [](entt::entity, visibility &vis) {
+                ++vis.nb_refresh;
+            });
+                    CHECK_GE(nb_processed, 1u);
+                    CHECK_LT(nb_processed, 64u);
+        }
+    }
+}
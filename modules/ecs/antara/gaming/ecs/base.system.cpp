@@ -14,8 +14,15 @@
  *                                                                            *
  ******************************************************************************/
 
+//! C System Headers
+#include <cmath> ///< std::lround
+
+//! C++ System Headers
+#include <algorithm> ///< std::max
+
 //! SDK Headers
 #include "antara/gaming/ecs/base.system.hpp"
+#include "antara/gaming/timer/time.step.hpp" ///< timer::time_step
 
 namespace antara::gaming::ecs {
     base_system::base_system(entt::registry &entity_registry,
@@ -65,4 +72,92 @@ namespace antara::gaming::ecs {
     void base_system::set_user_data(void *data) noexcept {
         user_data_ = data;
     }
-}
\ No newline at end of file
+
+    void base_system::sleep() noexcept {
+        sleeping_ = true;
+        wake_up_time_ = std::chrono::nanoseconds::max();
+    }
+
+    void base_system::sleep_for(std::chrono::nanoseconds delay) noexcept {
+        sleeping_ = true;
+        wake_up_time_ = game_time_() + delay;
+    }
+
+    void base_system::wake_up() noexcept {
+        sleeping_ = false;
+        wake_up_time_ = std::chrono::nanoseconds::max();
+    }
+
+    bool base_system::is_sleeping() const noexcept {
+        return sleeping_;
+    }
+
+    bool base_system::try_wake_up() noexcept {
+        if (not sleeping_) {
+            return true;
+        }
+        if (wake_up_time_ != std::chrono::nanoseconds::max() && game_time_() >= wake_up_time_) {
+            wake_up();
+            return true;
+        }
+        return false;
+    }
+
+    void base_system::set_event_driven(bool event_driven) noexcept {
+        event_driven_ = event_driven;
+    }
+
+    bool base_system::is_event_driven() const noexcept {
+        return event_driven_;
+    }
+
+    void base_system::set_tick_divisor(std::size_t divisor) noexcept {
+        tick_divisor_ = std::max<std::size_t>(divisor, 1u);
+        nb_substeps_ = 1u;
+    }
+
+    void base_system::set_tick_rate(float rate_hz) noexcept {
+        const float logic_rate = 1.f / timer::time_step::get_fixed_delta_time();
+        if (rate_hz <= 0.f || rate_hz >= logic_rate) {
+            tick_divisor_ = 1u;
+            nb_substeps_ = rate_hz <= 0.f ? 1u : static_cast<std::size_t>(std::max(std::lround(rate_hz / logic_rate), 1l));
+        } else {
+            set_tick_divisor(static_cast<std::size_t>(std::max(std::lround(logic_rate / rate_hz), 1l)));
+        }
+    }
+
+    void base_system::set_tick_phase(std::size_t phase) noexcept {
+        tick_phase_ = phase;
+    }
+
+    std::size_t base_system::get_tick_divisor() const noexcept {
+        return tick_divisor_;
+    }
+
+    std::size_t base_system::get_tick_phase() const noexcept {
+        return has_tick_phase() ? tick_phase_ % tick_divisor_ : 0u;
+    }
+
+    bool base_system::has_tick_phase() const noexcept {
+        return tick_phase_ != std::numeric_limits<std::size_t>::max();
+    }
+
+    std::size_t base_system::get_nb_substeps() const noexcept {
+        return nb_substeps_;
+    }
+
+    bool base_system::is_due(std::uint64_t logic_tick) const noexcept {
+        return tick_divisor_ == 1u || (logic_tick + get_tick_phase()) % tick_divisor_ == 0u;
+    }
+
+    std::chrono::nanoseconds base_system::game_time_() const noexcept {
+        //! a system used without a system_manager has no time_step, its game time never advances
+        auto timestep = entity_registry_.try_ctx<timer::time_step>();
+        return timestep != nullptr ? timestep->get_game_time() : std::chrono::nanoseconds{0};
+    }
+
+    float base_system::get_fixed_delta_time() const noexcept {
+        return timer::time_step::get_fixed_delta_time() * static_cast<float>(tick_divisor_) /
+               static_cast<float>(nb_substeps_);
+    }
+}
@@ -16,17 +16,48 @@
 
 #pragma once
 
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
 //! C++ System Headers
+#include <atomic> ///< std::atomic
+#include <chrono> ///< std::chrono::nanoseconds
+#include <limits> ///< std::numeric_limits
 #include <string> ///< std::string
+#include <vector> ///< std::vector
 
 //! Dependencies Headers
 #include <entt/entity/registry.hpp> ///< entt::registry
 #include <entt/signal/dispatcher.hpp> ///< entt::dispatcher
 
 //! SDK Headers
+#include "antara/gaming/ecs/group.declaration.hpp" ///< ecs::group_signature
 #include "antara/gaming/ecs/system.type.hpp" ///< ecs::system_type;
 
 namespace antara::gaming::ecs {
+    //! Dense identifier of a system type, used by the system_manager to index its systems
+    using system_id = std::size_t;
+
+    inline constexpr system_id invalid_system_id = std::numeric_limits<system_id>::max();
+
+    namespace details {
+        inline system_id next_system_id() noexcept {
+            static std::atomic<system_id> counter{0u};
+            return counter++;
+        }
+    }
+
+    /**
+     * @tparam TSystem type of the system
+     * @return the identifier of TSystem, identifiers are given in order of first use starting at 0.
+     */
+    template<typename TSystem>
+    system_id system_id_of() noexcept {
+        static const system_id id = details::next_system_id();
+        return id;
+    }
+
     class base_system {
     public:
         //! Constructors
@@ -44,6 +75,17 @@ namespace antara::gaming::ecs {
 
         [[nodiscard]] virtual system_type get_system_type_rtti() const noexcept = 0;
 
+        /**
+        * \note systems that do not derive from ecs::system have no identifier and are not indexed by the system_manager.
+        * \return identifier of the derived system type.
+        */
+        [[nodiscard]] virtual system_id get_system_id_rtti() const noexcept { return invalid_system_id; }
+
+        /**
+        * \note the system_manager creates these groups when the system is registered.
+        * \return signatures of the owning groups declared by the derived system, empty by default.
+        */
+        [[nodiscard]] virtual std::vector<group_signature> get_group_signatures_rtti() const noexcept { return {}; }
 
         /**
         * \note This function marks the system, it will be destroyed in the next turn of the game loop by the system_manager.
@@ -105,6 +147,99 @@ namespace antara::gaming::ecs {
          */
         void set_user_data(void *data) noexcept;
 
+        /**
+         * \note This function puts the system to sleep, the system_manager skips it until wake_up is called or one of its wake conditions fires.
+         */
+        void sleep() noexcept;
+
+        /**
+         * \note This function puts the system to sleep until the delay expires, or until it is woken up before.
+         * \note The delay is counted in game time (timer::time_step::get_game_time), so it follows the virtual clock and the time scale.
+         * \param delay game time to sleep
+         */
+        void sleep_for(std::chrono::nanoseconds delay) noexcept;
+
+        /**
+         * \note This function wakes the system up, it will be updated at the next update of its kind.
+         */
+        void wake_up() noexcept;
+
+        /**
+         * \note This function tell you if a system is sleeping or no.
+         * \return true if the system is sleeping, false otherwise
+         */
+        [[nodiscard]] bool is_sleeping() const noexcept;
+
+        /**
+         * \note This function wakes the system up if its sleep delay expired.
+         * \return true if the system is awake, false otherwise
+         */
+        bool try_wake_up() noexcept;
+
+        /**
+         * \note An event driven system goes back to sleep after each update, by default a system is not event driven.
+         * \note systems declaring wake_on_events or wake_on_components are event driven and start asleep.
+         * \param event_driven true to make the system event driven
+         */
+        void set_event_driven(bool event_driven) noexcept;
+
+        /**
+         * \note This function tell you if a system is event driven or no.
+         * \return true if the system goes back to sleep after each update, false otherwise
+         */
+        [[nodiscard]] bool is_event_driven() const noexcept;
+
+        /**
+         * \note A logic_update system with a divisor of N is updated every N logic ticks, by default the divisor is 1.
+         * \param divisor number of logic ticks between two updates of the system, 0 is treated as 1
+         */
+        void set_tick_divisor(std::size_t divisor) noexcept;
+
+        /**
+         * \note This function converts a rate to a tick divisor, or to substeps when the rate is above the logic rate of the time_step.
+         * \param rate_hz wanted number of updates per second, eg: 10 for an AI system, 120 for the movements
+         */
+        void set_tick_rate(float rate_hz) noexcept;
+
+        /**
+         * \note By default the system_manager staggers the phases so low-rate systems don't all land on the same logic tick.
+         * \param phase offset in logic ticks of the updates of the system
+         */
+        void set_tick_phase(std::size_t phase) noexcept;
+
+        [[nodiscard]] std::size_t get_tick_divisor() const noexcept;
+
+        [[nodiscard]] std::size_t get_tick_phase() const noexcept;
+
+        [[nodiscard]] bool has_tick_phase() const noexcept;
+
+        /**
+         * \return number of updates of the system per logic tick in which it is due, 1 unless the rate is above the logic rate.
+         */
+        [[nodiscard]] std::size_t get_nb_substeps() const noexcept;
+
+        /**
+         * \param logic_tick current logic tick of the system_manager
+         * \return true if the system has to be updated during this logic tick, false otherwise
+         */
+        [[nodiscard]] bool is_due(std::uint64_t logic_tick) const noexcept;
+
+        /**
+         * \note use this one instead of timer::time_step::get_fixed_delta_time in systems running at their own rate.
+         * \return fixed delta time of one update of the system in seconds
+         */
+        [[nodiscard]] float get_fixed_delta_time() const noexcept;
+
+        //! Callbacks
+
+        /// @brief wake condition connected to the dispatcher for every event of TSystem::wake_on_events
+        template<typename TEvent>
+        void wake_up_on_event(const TEvent &evt) noexcept;
+
+        /// @brief wake condition connected to the construction and the replacement of every component of TSystem::wake_on_components
+        template<typename TComponent>
+        void wake_up_on_component(entt::entity entity, entt::registry &registry, TComponent &component) noexcept;
+
     protected:
         //! Protected data members
         entt::registry &entity_registry_;
@@ -116,5 +251,16 @@ namespace antara::gaming::ecs {
         bool is_plugin_{false};
         bool marked_{false};
         bool enabled_{true};
+        bool sleeping_{false};
+        bool event_driven_{false};
+        std::size_t tick_divisor_{1u};
+        std::size_t tick_phase_{std::numeric_limits<std::size_t>::max()};
+        std::size_t nb_substeps_{1u};
+        std::chrono::nanoseconds wake_up_time_{std::chrono::nanoseconds::max()};
+
+        [[nodiscard]] std::chrono::nanoseconds game_time_() const noexcept;
     };
-}
\ No newline at end of file
+}
+
+//! Implementation
+#include "antara/gaming/ecs/base.system.ipp"
\ No newline at end of file
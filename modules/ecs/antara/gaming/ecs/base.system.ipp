@@ -0,0 +1,29 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+namespace antara::gaming::ecs {
+    template<typename TEvent>
+    void base_system::wake_up_on_event(const TEvent &) noexcept {
+        wake_up();
+    }
+
+    template<typename TComponent>
+    void base_system::wake_up_on_component(entt::entity, entt::registry &, TComponent &) noexcept {
+        wake_up();
+    }
+}
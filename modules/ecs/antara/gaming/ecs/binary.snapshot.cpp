@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <cstring> ///< std::memcpy
+#include <unordered_set> ///< std::unordered_set
+
+//! SDK Headers
+#include "antara/gaming/ecs/binary.snapshot.hpp"
+
+namespace antara::gaming::ecs::details {
+    snapshot_writer::snapshot_writer(std::vector<std::uint8_t> &out) noexcept : out_(out) {
+    }
+
+    void snapshot_writer::write_bytes(const void *data, std::size_t size) noexcept {
+        if (size == 0u) {
+            return;
+        }
+        const auto offset = out_.size();
+        out_.resize(offset + size);
+        std::memcpy(out_.data() + offset, data, size);
+    }
+
+    void snapshot_writer::write_string(std::string_view str) noexcept {
+        write_pod(static_cast<std::uint32_t>(str.size()));
+        write_bytes(str.data(), str.size());
+    }
+
+    std::size_t snapshot_writer::size() const noexcept {
+        return out_.size();
+    }
+
+    void snapshot_writer::patch_u64(std::size_t offset, std::uint64_t value) noexcept {
+        std::memcpy(out_.data() + offset, &value, sizeof(value));
+    }
+
+    snapshot_reader::snapshot_reader(const std::uint8_t *data, std::size_t size) noexcept :
+            cursor_(data), end_(data + size) {
+    }
+
+    bool snapshot_reader::read_bytes(void *data, std::size_t size) noexcept {
+        auto bytes = take(size);
+        if (bytes == nullptr) {
+            return false;
+        }
+        if (size != 0u) {
+            std::memcpy(data, bytes, size);
+        }
+        return true;
+    }
+
+    bool snapshot_reader::read_string(std::string &str) noexcept {
+        std::uint32_t size = 0u;
+        if (not read_pod(size)) {
+            return false;
+        }
+        auto bytes = take(size);
+        if (bytes == nullptr) {
+            return false;
+        }
+        str.assign(reinterpret_cast<const char *>(bytes), size);
+        return true;
+    }
+
+    const std::uint8_t *snapshot_reader::take(std::size_t size) noexcept {
+        if (static_cast<std::size_t>(end_ - cursor_) < size) {
+            return nullptr;
+        }
+        auto bytes = cursor_;
+        cursor_ += size;
+        return bytes;
+    }
+
+    bool snapshot_reader::at_end() const noexcept {
+        return cursor_ == end_;
+    }
+
+    std::uint64_t fnv1a(std::uint64_t hash, std::string_view str) noexcept {
+        if (hash == 0u) {
+            hash = 14695981039346656037ull;
+        }
+        for (auto &&c : str) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::uint64_t fnv1a(std::uint64_t hash, std::uint64_t value) noexcept {
+        char bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        return fnv1a(hash, std::string_view(bytes, sizeof(bytes)));
+    }
+
+    const char *intern(const std::string &str) noexcept {
+        static std::unordered_set<std::string> strings;
+        return strings.insert(str).first->c_str();
+    }
+}
+
+namespace antara::gaming::ecs {
+    std::vector<std::uint8_t> save_binary_snapshot(entt::registry &registry) noexcept {
+        return save_binary_snapshot(registry, component::components_list{});
+    }
+
+    tl::expected<std::size_t, std::error_code>
+    load_binary_snapshot(entt::registry &registry, const std::vector<std::uint8_t> &snapshot) noexcept {
+        return load_binary_snapshot(registry, snapshot, component::components_list{});
+    }
+}
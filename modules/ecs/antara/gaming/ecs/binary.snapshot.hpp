@@ -0,0 +1,161 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint8_t, std::uint32_t, std::uint64_t
+
+//! C++ System Headers
+#include <string> ///< std::string
+#include <string_view> ///< std::string_view
+#include <system_error> ///< std::error_code
+#include <type_traits> ///< std::is_empty_v, std::is_trivially_copyable_v, std::is_pointer_v
+#include <utility> ///< std::pair
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry, entt::entity
+#include <meta/sequence/list.hpp> ///< doom::meta::list
+#include <tl/expected.hpp> ///< tl::expected
+
+//! SDK Headers
+#include "antara/gaming/core/safe.refl.hpp" ///< refl::reflect, refl::trait
+#include "antara/gaming/ecs/all.components.hpp" ///< ecs::component::components_list
+
+namespace antara::gaming::ecs {
+    //! Version of the binary snapshot layout, snapshots written with another version are refused
+    inline constexpr std::uint32_t binary_snapshot_version = 1u;
+
+    namespace details {
+        //! Append only byte buffer used to write a snapshot
+        class snapshot_writer {
+            std::vector<std::uint8_t> &out_;
+        public:
+            explicit snapshot_writer(std::vector<std::uint8_t> &out) noexcept;
+
+            void write_bytes(const void *data, std::size_t size) noexcept;
+
+            void write_string(std::string_view str) noexcept;
+
+            template<typename T>
+            void write_pod(const T &value) noexcept { write_bytes(&value, sizeof(T)); }
+
+            [[nodiscard]] std::size_t size() const noexcept;
+
+            void patch_u64(std::size_t offset, std::uint64_t value) noexcept;
+        };
+
+        //! Bounds checked cursor over a snapshot
+        class snapshot_reader {
+            const std::uint8_t *cursor_;
+            const std::uint8_t *end_;
+        public:
+            snapshot_reader(const std::uint8_t *data, std::size_t size) noexcept;
+
+            bool read_bytes(void *data, std::size_t size) noexcept;
+
+            bool read_string(std::string &str) noexcept;
+
+            template<typename T>
+            bool read_pod(T &value) noexcept { return read_bytes(&value, sizeof(T)); }
+
+            /// @return pointer to the next size bytes and move past them, nullptr if the snapshot is truncated
+            const std::uint8_t *take(std::size_t size) noexcept;
+
+            [[nodiscard]] bool at_end() const noexcept;
+        };
+
+        std::uint64_t fnv1a(std::uint64_t hash, std::string_view str) noexcept;
+
+        std::uint64_t fnv1a(std::uint64_t hash, std::uint64_t value) noexcept;
+
+        //! Storage of the C strings restored from a snapshot, they live as long as the program
+        const char *intern(const std::string &str) noexcept;
+
+        template<typename T>
+        struct is_vector : std::false_type {
+        };
+
+        template<typename T, typename TAllocator>
+        struct is_vector<std::vector<T, TAllocator>> : std::true_type {
+        };
+
+        //! Trivially copyable and not a pointer: written as raw bytes
+        template<typename T>
+        inline constexpr bool is_blob_v = std::is_trivially_copyable_v<T> && not std::is_pointer_v<T>;
+
+        template<typename T>
+        std::uint64_t schema_hash(std::uint64_t hash) noexcept;
+
+        template<typename T>
+        void write_value(snapshot_writer &writer, const T &value) noexcept;
+
+        template<typename T>
+        bool read_value(snapshot_reader &reader, T &value) noexcept;
+
+        template<typename TComponent>
+        void write_component(snapshot_writer &writer, entt::registry &registry) noexcept;
+
+        template<typename TComponent>
+        std::error_code read_component(snapshot_reader &reader, entt::registry &registry, const std::uint8_t *entities,
+                                       std::size_t nb_entities,
+                                       const std::vector<std::pair<entt::entity, entt::entity>> &mapping) noexcept;
+    }
+
+    /**
+     * @brief write the entities of the registry and the given components into a binary snapshot.
+     * @tparam TComponents reflected components to save, each one is written as a contiguous blob.
+     * @return the snapshot
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Layout: a header (magic, binary_snapshot_version, number of entities and of components), the entity table,
+     *         then one record per component: its reflected name, a schema hash computed from its refl metadata, the
+     *         entities owning it and the blob. Trivially copyable components are copied from their pool in one go, the
+     *         others are written field by field through their REFL_AUTO metadata.
+     * @endverbatim
+     */
+    template<typename ... TComponents>
+    std::vector<std::uint8_t>
+    save_binary_snapshot(entt::registry &registry, doom::meta::list<TComponents...> components) noexcept;
+
+    /// @overload save_binary_snapshot, saves every component of ecs::component::components_list
+    std::vector<std::uint8_t> save_binary_snapshot(entt::registry &registry) noexcept;
+
+    /**
+     * @brief restore a binary snapshot into the registry, entities are created and the components assigned.
+     * @return number of entities restored, or:
+     *         std::errc::illegal_byte_sequence if this is not a snapshot,
+     *         std::errc::not_supported if it was written with another binary_snapshot_version,
+     *         std::errc::invalid_argument if the schema of a component changed since the snapshot was written,
+     *         std::errc::result_out_of_range if the snapshot is truncated.
+     * @note components of the snapshot which are not in TComponents are skipped.
+     * @note on error the entities created by the load are destroyed, the registry is left as it was.
+     */
+    template<typename ... TComponents>
+    tl::expected<std::size_t, std::error_code>
+    load_binary_snapshot(entt::registry &registry, const std::vector<std::uint8_t> &snapshot,
+                         doom::meta::list<TComponents...> components) noexcept;
+
+    /// @overload load_binary_snapshot, restores every component of ecs::component::components_list
+    tl::expected<std::size_t, std::error_code>
+    load_binary_snapshot(entt::registry &registry, const std::vector<std::uint8_t> &snapshot) noexcept;
+}
+
+//! Implementation
+#include "antara/gaming/ecs/binary.snapshot.ipp"
@@ -0,0 +1,278 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C++ System Headers
+#include <algorithm> ///< std::sort, std::lower_bound
+#include <cstring> ///< std::memcpy
+#include <utility> ///< std::pair, std::move
+
+namespace antara::gaming::ecs::details {
+    template<typename T>
+    inline constexpr bool always_false_v = false;
+
+    template<typename T>
+    std::uint64_t schema_hash(std::uint64_t hash) noexcept {
+        if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, const char *>) {
+            return fnv1a(hash, "string");
+        } else if constexpr (is_vector<T>::value) {
+            return schema_hash<typename T::value_type>(fnv1a(hash, "vector"));
+        } else {
+            hash = fnv1a(hash, sizeof(T));
+            if constexpr (refl::trait::is_reflectable_v<T>) {
+                refl::util::for_each(refl::reflect<T>().members, [&hash](auto member) {
+                    if constexpr (refl::trait::is_field_v<decltype(member)>) {
+                        using field_t = std::remove_cv_t<std::remove_reference_t<decltype(member(std::declval<T &>()))>>;
+                        hash = schema_hash<field_t>(fnv1a(hash, member.name.str()));
+                    }
+                });
+            }
+            return hash;
+        }
+    }
+
+    template<typename T>
+    void write_value(snapshot_writer &writer, const T &value) noexcept {
+        if constexpr (std::is_same_v<T, std::string>) {
+            writer.write_string(value);
+        } else if constexpr (std::is_same_v<T, const char *>) {
+            writer.write_string(value != nullptr ? value : "");
+        } else if constexpr (is_vector<T>::value) {
+            writer.write_pod(static_cast<std::uint32_t>(value.size()));
+            if constexpr (is_blob_v<typename T::value_type>) {
+                writer.write_bytes(value.data(), value.size() * sizeof(typename T::value_type));
+            } else {
+                for (auto &&element : value) {
+                    write_value(writer, element);
+                }
+            }
+        } else if constexpr (is_blob_v<T>) {
+            writer.write_pod(value);
+        } else if constexpr (refl::trait::is_reflectable_v<T>) {
+            refl::util::for_each(refl::reflect<T>().members, [&writer, &value](auto member) {
+                if constexpr (refl::trait::is_field_v<decltype(member)>) {
+                    write_value(writer, member(value));
+                }
+            });
+        } else {
+            static_assert(always_false_v<T>, "component field is neither trivially copyable nor reflected");
+        }
+    }
+
+    template<typename T>
+    bool read_value(snapshot_reader &reader, T &value) noexcept {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return reader.read_string(value);
+        } else if constexpr (std::is_same_v<T, const char *>) {
+            std::string str;
+            if (not reader.read_string(str)) {
+                return false;
+            }
+            value = intern(str);
+            return true;
+        } else if constexpr (is_vector<T>::value) {
+            std::uint32_t size = 0u;
+            if (not reader.read_pod(size)) {
+                return false;
+            }
+            value.resize(size);
+            if constexpr (is_blob_v<typename T::value_type>) {
+                return reader.read_bytes(value.data(), value.size() * sizeof(typename T::value_type));
+            } else {
+                for (auto &&element : value) {
+                    if (not read_value(reader, element)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        } else if constexpr (is_blob_v<T>) {
+            return reader.read_pod(value);
+        } else if constexpr (refl::trait::is_reflectable_v<T>) {
+            bool result = true;
+            refl::util::for_each(refl::reflect<T>().members, [&reader, &value, &result](auto member) {
+                if constexpr (refl::trait::is_field_v<decltype(member)>) {
+                    result = result && read_value(reader, member(value));
+                }
+            });
+            return result;
+        } else {
+            static_assert(always_false_v<T>, "component field is neither trivially copyable nor reflected");
+            return false;
+        }
+    }
+
+    template<typename TComponent>
+    void write_component(snapshot_writer &writer, entt::registry &registry) noexcept {
+        auto view = registry.view<TComponent>();
+        const auto nb_entities = view.size();
+        writer.write_string(refl::reflect<TComponent>().name.str());
+        writer.write_pod(schema_hash<TComponent>(fnv1a(0u, refl::reflect<TComponent>().name.str())));
+        writer.write_pod(static_cast<std::uint32_t>(nb_entities));
+        writer.write_bytes(view.data(), nb_entities * sizeof(entt::entity));
+        const auto blob_size_offset = writer.size();
+        writer.write_pod(std::uint64_t{0u});
+        if constexpr (std::is_empty_v<TComponent>) {
+            //! tags: the entity list is the whole record
+        } else if constexpr (is_blob_v<TComponent>) {
+            writer.write_bytes(view.raw(), nb_entities * sizeof(TComponent));
+        } else {
+            const TComponent *components = view.raw();
+            for (std::size_t idx = 0u; idx < nb_entities; ++idx) {
+                write_value(writer, components[idx]);
+            }
+        }
+        writer.patch_u64(blob_size_offset, writer.size() - blob_size_offset - sizeof(std::uint64_t));
+    }
+
+    template<typename TComponent>
+    std::error_code read_component(snapshot_reader &reader, entt::registry &registry, const std::uint8_t *entities,
+                                   std::size_t nb_entities,
+                                   const std::vector<std::pair<entt::entity, entt::entity>> &mapping) noexcept {
+        static_assert(std::is_default_constructible_v<TComponent>, "restored components must be default constructible");
+        auto restored_entity = [&mapping, entities](std::size_t idx) noexcept {
+            entt::entity saved;
+            std::memcpy(&saved, entities + idx * sizeof(entt::entity), sizeof(entt::entity));
+            auto it = std::lower_bound(mapping.begin(), mapping.end(), saved,
+                                       [](const auto &lhs, entt::entity rhs) { return lhs.first < rhs; });
+            entt::entity restored = entt::null;
+            if (it != mapping.end() && it->first == saved) {
+                restored = it->second;
+            }
+            return restored;
+        };
+        for (std::size_t idx = 0u; idx < nb_entities; ++idx) {
+            const auto entity = restored_entity(idx);
+            if (entity == entt::null) {
+                return std::make_error_code(std::errc::result_out_of_range);
+            }
+            if constexpr (std::is_empty_v<TComponent>) {
+                registry.assign_or_replace<TComponent>(entity);
+            } else {
+                TComponent component{};
+                if (not read_value(reader, component)) {
+                    return std::make_error_code(std::errc::result_out_of_range);
+                }
+                registry.assign_or_replace<TComponent>(entity, std::move(component));
+            }
+        }
+        return {};
+    }
+
+    template<typename TComponent>
+    bool try_read_component(snapshot_reader &blob, entt::registry &registry, const std::string &name,
+                            std::uint64_t schema, const std::uint8_t *entities, std::size_t nb_entities,
+                            const std::vector<std::pair<entt::entity, entt::entity>> &mapping,
+                            std::error_code &ec) noexcept {
+        if (name != refl::reflect<TComponent>().name.str()) {
+            return false;
+        }
+        if (schema != schema_hash<TComponent>(fnv1a(0u, name))) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+        } else {
+            ec = read_component<TComponent>(blob, registry, entities, nb_entities, mapping);
+        }
+        return true;
+    }
+}
+
+namespace antara::gaming::ecs {
+    template<typename ... TComponents>
+    std::vector<std::uint8_t>
+    save_binary_snapshot(entt::registry &registry, doom::meta::list<TComponents...>) noexcept {
+        std::vector<std::uint8_t> out;
+        details::snapshot_writer writer{out};
+        writer.write_bytes("ASNP", 4u);
+        writer.write_pod(binary_snapshot_version);
+        std::vector<entt::entity> entities;
+        entities.reserve(registry.alive());
+        registry.each([&entities](entt::entity entity) { entities.push_back(entity); });
+        writer.write_pod(static_cast<std::uint32_t>(entities.size()));
+        writer.write_pod(static_cast<std::uint32_t>(sizeof...(TComponents)));
+        writer.write_bytes(entities.data(), entities.size() * sizeof(entt::entity));
+        (details::write_component<TComponents>(writer, registry), ...);
+        return out;
+    }
+
+    template<typename ... TComponents>
+    tl::expected<std::size_t, std::error_code>
+    load_binary_snapshot(entt::registry &registry, const std::vector<std::uint8_t> &snapshot,
+                         doom::meta::list<TComponents...>) noexcept {
+        auto failure = [](std::errc err) { return tl::make_unexpected(std::make_error_code(err)); };
+        details::snapshot_reader reader{snapshot.data(), snapshot.size()};
+        char magic[4];
+        std::uint32_t version = 0u, nb_entities = 0u, nb_components = 0u;
+        if (not reader.read_bytes(magic, 4u) || std::string_view(magic, 4u) != "ASNP") {
+            return failure(std::errc::illegal_byte_sequence);
+        }
+        if (not reader.read_pod(version) || version != binary_snapshot_version) {
+            return failure(std::errc::not_supported);
+        }
+        if (not reader.read_pod(nb_entities) || not reader.read_pod(nb_components)) {
+            return failure(std::errc::result_out_of_range);
+        }
+        auto saved_entities = reader.take(nb_entities * sizeof(entt::entity));
+        if (saved_entities == nullptr) {
+            return failure(std::errc::result_out_of_range);
+        }
+
+        //! saved entity -> restored entity, sorted for the lookups of the component records
+        std::vector<std::pair<entt::entity, entt::entity>> mapping(nb_entities);
+        for (std::size_t idx = 0u; idx < nb_entities; ++idx) {
+            std::memcpy(&mapping[idx].first, saved_entities + idx * sizeof(entt::entity), sizeof(entt::entity));
+            mapping[idx].second = registry.create();
+        }
+        std::sort(mapping.begin(), mapping.end(),
+                  [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+        auto read_records = [&]() noexcept -> std::error_code {
+            for (std::uint32_t component_idx = 0u; component_idx < nb_components; ++component_idx) {
+                std::string name;
+                std::uint64_t schema = 0u, blob_size = 0u;
+                std::uint32_t nb_owners = 0u;
+                if (not reader.read_string(name) || not reader.read_pod(schema) || not reader.read_pod(nb_owners)) {
+                    return std::make_error_code(std::errc::result_out_of_range);
+                }
+                auto owners = reader.take(nb_owners * sizeof(entt::entity));
+                if (owners == nullptr || not reader.read_pod(blob_size)) {
+                    return std::make_error_code(std::errc::result_out_of_range);
+                }
+                auto blob_data = reader.take(blob_size);
+                if (blob_data == nullptr) {
+                    return std::make_error_code(std::errc::result_out_of_range);
+                }
+                details::snapshot_reader blob{blob_data, blob_size};
+                std::error_code ec;
+                static_cast<void>((details::try_read_component<TComponents>(
+                        blob, registry, name, schema, owners, nb_owners, mapping, ec)
+                        || ...));
+                if (ec) {
+                    return ec;
+                }
+            }
+            return {};
+        };
+        if (auto ec = read_records(); ec) {
+            //! only the entities created above hold restored components, destroying them undoes the partial load
+            for (auto &&entry : mapping) {
+                registry.destroy(entry.second);
+            }
+            return tl::make_unexpected(ec);
+        }
+        return nb_entities;
+    }
+}
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <algorithm> ///< std::remove_if
+
+//! SDK Headers
+#include "antara/gaming/ecs/change.tracker.hpp"
+
+//! Anonymous Implementation
+namespace {
+    std::size_t index_of(entt::entity entity) noexcept {
+        return static_cast<std::size_t>(entt::registry::entity(entity));
+    }
+}
+
+namespace antara::gaming::ecs::details {
+    bool change_log::is_latest_(const stamp &entry) const noexcept {
+        const auto idx = index_of(entry.entity);
+        return idx < stamps_.size() && stamps_[idx].entity == entry.entity && stamps_[idx].tick == entry.tick;
+    }
+
+    void change_log::compact_() noexcept {
+        log_.erase(std::remove_if(log_.begin(), log_.end(), [this](const stamp &entry) {
+            return not is_latest_(entry);
+        }), log_.end());
+    }
+
+    void change_log::record(entt::entity entity, std::uint64_t tick) noexcept {
+        const auto idx = index_of(entity);
+        if (idx >= stamps_.size()) {
+            stamps_.resize(idx + 1);
+        }
+        if (stamps_[idx].tick == 0u) {
+            ++nb_stamped_;
+        }
+        stamps_[idx] = {entity, tick};
+        log_.push_back({entity, tick});
+        if (log_.size() > 2u * nb_stamped_ + 64u) {
+            compact_();
+        }
+    }
+
+    std::uint64_t change_log::changed_at(entt::entity entity) const noexcept {
+        const auto idx = index_of(entity);
+        return idx < stamps_.size() && stamps_[idx].entity == entity ? stamps_[idx].tick : 0u;
+    }
+
+    std::size_t change_log::log_size() const noexcept {
+        return log_.size();
+    }
+}
+
+namespace antara::gaming::ecs {
+    std::uint64_t change_tracker::tick() const noexcept {
+        return tick_;
+    }
+}
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <memory> ///< std::unique_ptr
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry, entt::entity
+
+//! SDK Headers
+#include "antara/gaming/ecs/group.declaration.hpp" ///< ecs::component_id_of
+
+namespace antara::gaming::ecs {
+    namespace details {
+        /**
+         * @class change_log
+         * @brief Last change tick of every entity of one component type, and the changes in tick order.
+         * @note older entries of an entity which changed again are skipped, then compacted away once they outnumber the live ones.
+         */
+        class change_log {
+            //! Private typedefs
+            struct stamp {
+                entt::entity entity{entt::null};
+                std::uint64_t tick{0u};
+            };
+
+            //! Private fields
+            std::vector<stamp> stamps_; ///< indexed by entity identifier
+            std::vector<stamp> log_; ///< ascending ticks
+            std::size_t nb_stamped_{0u};
+
+            //! Private member functions
+            [[nodiscard]] bool is_latest_(const stamp &entry) const noexcept;
+
+            void compact_() noexcept;
+
+        public:
+            void record(entt::entity entity, std::uint64_t tick) noexcept;
+
+            [[nodiscard]] std::uint64_t changed_at(entt::entity entity) const noexcept;
+
+            /// @brief call functor(entity) once per entity changed after the given tick, in change order.
+            template<typename TFunctor>
+            void each_since(std::uint64_t since, TFunctor &&functor) const;
+
+            [[nodiscard]] std::size_t log_size() const noexcept;
+        };
+    }
+
+    /**
+     * @class change_tracker
+     * @brief Change ticks of the tracked components, to process only the entities changed since a given tick.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The tick is a counter advanced at every recorded change, so a system which saves tick() once it is done
+     *         sees every later change exactly once, whichever system made it.
+     *         Constructions and `registry.replace` are recorded through the registry signals, components modified in place
+     *         through `registry.get` have to be flagged with mark_changed.
+     *         The tracker is connected to the registry signals, set it in the registry context so it lives as long as the registry.
+     * @endverbatim
+     *
+     * **Example:**
+     * @code{.cpp}
+     *          auto &tracker = registry.set<ecs::change_tracker>();
+     *          tracker.track<transform::position_2d>(registry);
+     *
+     *          //! in a system update
+     *          tracker.each_changed<transform::position_2d>(registry, last_tick_, [](entt::entity entity, auto &pos) {
+     *              //! refresh the spatial index of entity
+     *          });
+     *          last_tick_ = tracker.tick();
+     * @endcode
+     */
+    class change_tracker {
+        //! Private fields
+        std::uint64_t tick_{0u};
+        std::vector<std::unique_ptr<details::change_log>> logs_; ///< indexed by component_id
+
+        //! Private member functions
+        template<typename TComponent>
+        details::change_log &log_() noexcept;
+
+        template<typename TComponent>
+        [[nodiscard]] const details::change_log *find_log_() const noexcept;
+
+        template<typename TComponent>
+        void on_change_(entt::entity entity, entt::registry &registry, TComponent &component) noexcept;
+
+    public:
+        //! Public member functions
+
+        /// @brief record the constructions and the replacements of TComponent from now on.
+        template<typename TComponent>
+        void track(entt::registry &registry) noexcept;
+
+        /// @brief record a change made in place, without going through the registry.
+        template<typename TComponent>
+        void mark_changed(entt::entity entity) noexcept;
+
+        /// @return tick of the latest recorded change, 0 if none
+        [[nodiscard]] std::uint64_t tick() const noexcept;
+
+        /// @return tick of the latest change of TComponent for this entity, 0 if never changed
+        template<typename TComponent>
+        [[nodiscard]] std::uint64_t changed_at(entt::entity entity) const noexcept;
+
+        /// @brief filter for views: true if TComponent of this entity changed after the given tick.
+        template<typename TComponent>
+        [[nodiscard]] bool changed_since(entt::entity entity, std::uint64_t since) const noexcept;
+
+        /**
+         * @brief call functor(entity, component) for every entity which still has TComponent and whose TComponent changed after the given tick.
+         * @return number of entities visited
+         */
+        template<typename TComponent, typename TFunctor>
+        std::size_t each_changed(entt::registry &registry, std::uint64_t since, TFunctor &&functor);
+    };
+}
+
+//! Implementation
+#include "antara/gaming/ecs/change.tracker.ipp"
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C++ System Headers
+#include <algorithm> ///< std::upper_bound
+#include <utility> ///< std::forward
+
+namespace antara::gaming::ecs::details {
+    template<typename TFunctor>
+    void change_log::each_since(std::uint64_t since, TFunctor &&functor) const {
+        auto first = std::upper_bound(log_.begin(), log_.end(), since, [](std::uint64_t tick, const stamp &entry) {
+            return tick < entry.tick;
+        });
+        for (; first != log_.end(); ++first) {
+            if (is_latest_(*first)) {
+                functor(first->entity);
+            }
+        }
+    }
+}
+
+namespace antara::gaming::ecs {
+    template<typename TComponent>
+    details::change_log &change_tracker::log_() noexcept {
+        const auto id = component_id_of<TComponent>();
+        if (id >= logs_.size()) {
+            logs_.resize(id + 1);
+        }
+        if (logs_[id] == nullptr) {
+            logs_[id] = std::make_unique<details::change_log>();
+        }
+        return *logs_[id];
+    }
+
+    template<typename TComponent>
+    const details::change_log *change_tracker::find_log_() const noexcept {
+        const auto id = component_id_of<TComponent>();
+        return id < logs_.size() ? logs_[id].get() : nullptr;
+    }
+
+    template<typename TComponent>
+    void change_tracker::on_change_(entt::entity entity, entt::registry &, TComponent &) noexcept {
+        mark_changed<TComponent>(entity);
+    }
+
+    template<typename TComponent>
+    void change_tracker::track(entt::registry &registry) noexcept {
+        static_cast<void>(log_<TComponent>());
+        registry.on_construct<TComponent>().template connect<&change_tracker::on_change_<TComponent>>(*this);
+        registry.on_replace<TComponent>().template connect<&change_tracker::on_change_<TComponent>>(*this);
+    }
+
+    template<typename TComponent>
+    void change_tracker::mark_changed(entt::entity entity) noexcept {
+        log_<TComponent>().record(entity, ++tick_);
+    }
+
+    template<typename TComponent>
+    std::uint64_t change_tracker::changed_at(entt::entity entity) const noexcept {
+        auto log = find_log_<TComponent>();
+        return log != nullptr ? log->changed_at(entity) : 0u;
+    }
+
+    template<typename TComponent>
+    bool change_tracker::changed_since(entt::entity entity, std::uint64_t since) const noexcept {
+        return changed_at<TComponent>(entity) > since;
+    }
+
+    template<typename TComponent, typename TFunctor>
+    std::size_t change_tracker::each_changed(entt::registry &registry, std::uint64_t since, TFunctor &&functor) {
+        auto log = find_log_<TComponent>();
+        if (log == nullptr) {
+            return 0u;
+        }
+        std::size_t nb_visited = 0u;
+        log->each_since(since, [&registry, &functor, &nb_visited](entt::entity entity) {
+            if (registry.valid(entity) && registry.has<TComponent>(entity)) {
+                functor(entity, registry.get<TComponent>(entity));
+                ++nb_visited;
+            }
+        });
+        return nb_visited;
+    }
+}
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <algorithm> ///< std::includes, std::set_intersection
+#include <iterator> ///< std::back_inserter
+
+//! Dependencies Headers
+#include <loguru.hpp> ///< VLOG_F
+
+//! SDK Headers
+#include "antara/gaming/ecs/group.declaration.hpp"
+
+namespace antara::gaming::ecs {
+    bool group_signature::same_group(const group_signature &other) const noexcept {
+        return owned == other.owned && observed == other.observed;
+    }
+
+    bool group_signature::nested_in(const group_signature &other) const noexcept {
+        return std::includes(other.owned.begin(), other.owned.end(), owned.begin(), owned.end()) &&
+               std::includes(other.observed.begin(), other.observed.end(), observed.begin(), observed.end());
+    }
+
+    bool group_signature::conflicts_with(const group_signature &other) const noexcept {
+        if (same_group(other) || nested_in(other) || other.nested_in(*this)) {
+            return false;
+        }
+        std::vector<component_id> shared;
+        std::set_intersection(owned.begin(), owned.end(), other.owned.begin(), other.owned.end(),
+                              std::back_inserter(shared));
+        return not shared.empty();
+    }
+
+    bool group_declarations::declare(entt::registry &registry, const group_signature &sig,
+                                     const std::string &owner) noexcept {
+        for (auto &&[declared, declared_owner] : declarations_) {
+            if (declared.same_group(sig)) {
+                return true;
+            }
+            if (declared.conflicts_with(sig)) {
+                VLOG_F(loguru::Verbosity_ERROR,
+                       "group declared by {} owns components already owned by a group of {} without nesting it",
+                       owner, declared_owner);
+                return false;
+            }
+        }
+        sig.create(registry);
+        declarations_.emplace_back(sig, owner);
+        return true;
+    }
+
+    std::size_t group_declarations::size() const noexcept {
+        return declarations_.size();
+    }
+}
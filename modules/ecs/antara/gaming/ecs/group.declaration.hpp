@@ -0,0 +1,158 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+
+//! C++ System Headers
+#include <algorithm> ///< std::sort
+#include <atomic> ///< std::atomic
+#include <string> ///< std::string
+#include <utility> ///< std::pair
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry, entt::get
+#include <meta/detection/detection.hpp> ///< doom::meta::is_detected
+#include <meta/sequence/list.hpp> ///< doom::meta::list
+
+namespace antara::gaming::ecs {
+    //! Identifier of a component type, used to compare group declarations and to index per component storages
+    using component_id = std::size_t;
+
+    namespace details {
+        inline component_id next_component_id() noexcept {
+            static std::atomic<component_id> counter{0u};
+            return counter++;
+        }
+    }
+
+    template<typename TComponent>
+    component_id component_id_of() noexcept {
+        static const component_id id = details::next_component_id();
+        return id;
+    }
+
+    /**
+     * @struct group_signature
+     * @brief Type erased group_declaration, compared by the system_manager to detect conflicting ownerships.
+     */
+    struct group_signature {
+        //! Fields
+        std::vector<component_id> owned; ///< sorted
+        std::vector<component_id> observed; ///< sorted
+        void (*create)(entt::registry &) noexcept {nullptr};
+
+        /// @return true if both signatures describe the same group
+        [[nodiscard]] bool same_group(const group_signature &other) const noexcept;
+
+        /// @return true if other owns (observes) every component owned (observed) by this group, other is nested in it
+        [[nodiscard]] bool nested_in(const group_signature &other) const noexcept;
+
+        /**
+         * @return true if both groups can't exist in the same registry: they own a common component and none of them is
+         *         nested in the other, as EnTT only shares owned pools between nested groups.
+         */
+        [[nodiscard]] bool conflicts_with(const group_signature &other) const noexcept;
+    };
+
+    /**
+     * @struct group_declaration
+     * @brief Declaration of an owning (or partial-owning) group for a hot combination of components.
+     * @tparam TOwned doom::meta::list of the components owned by the group, their pools are packed and aligned.
+     * @tparam TObserved doom::meta::list of the components only observed by the group.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         A system declares its groups with an owned_groups typedef, the system_manager creates them when the system is
+     *         registered, before the entities fill the pools, and reports a fatal_error if two declarations own the same
+     *         component through groups which are not nested (one of them owning and observing a subset of the other).
+     * @endverbatim
+     *
+     * **Example:**
+     * @code{.cpp}
+     *          struct physics_system final : ecs::logic_update_system<physics_system> {
+     *              using moving_group = ecs::group_declaration<doom::meta::list<position_2d, velocity>, doom::meta::list<mass>>;
+     *              using owned_groups = doom::meta::list<moving_group>;
+     *
+     *              void update() noexcept final {
+     *                  moving_group::get(entity_registry_).each([](auto &&pos, auto &&vel, auto &&mass) {});
+     *              }
+     *          };
+     * @endcode
+     */
+    template<typename TOwned, typename TObserved = doom::meta::list<>>
+    struct group_declaration;
+
+    template<typename ... TOwned, typename ... TObserved>
+    struct group_declaration<doom::meta::list<TOwned...>, doom::meta::list<TObserved...>> {
+        static_assert(sizeof...(TOwned) > 0u, "an owning group needs at least one owned component");
+
+        /// @return the group, created on first call
+        static auto get(entt::registry &registry) noexcept {
+            return registry.group<TOwned...>(entt::get<TObserved...>);
+        }
+
+        static void create(entt::registry &registry) noexcept {
+            static_cast<void>(get(registry));
+        }
+
+        static group_signature signature() noexcept {
+            group_signature sig{{component_id_of<TOwned>()...}, {component_id_of<TObserved>()...}, &create};
+            std::sort(sig.owned.begin(), sig.owned.end());
+            std::sort(sig.observed.begin(), sig.observed.end());
+            return sig;
+        }
+    };
+
+    //! Meta-functions
+    template<typename TSystem>
+    using owned_groups_t = typename TSystem::owned_groups;
+
+    template<typename ... TDeclarations>
+    std::vector<group_signature> group_signatures_of(doom::meta::list<TDeclarations...>) noexcept {
+        return {TDeclarations::signature()...};
+    }
+
+    /// @return the signatures of the groups declared by TSystem through its owned_groups typedef, if any.
+    template<typename TSystem>
+    std::vector<group_signature> group_signatures_of() noexcept {
+        if constexpr (doom::meta::is_detected_v<owned_groups_t, TSystem>) {
+            return group_signatures_of(owned_groups_t<TSystem>{});
+        } else {
+            return {};
+        }
+    }
+
+    /**
+     * @class group_declarations
+     * @brief Owning groups declared in a registry along with the name of the system which declared them.
+     */
+    class group_declarations {
+        //! Private fields
+        std::vector<std::pair<group_signature, std::string>> declarations_;
+    public:
+        /**
+         * @brief create the group if it doesn't conflict with a previous declaration.
+         * @return false if the declaration conflicts, true if the group is created or already declared
+         */
+        bool declare(entt::registry &registry, const group_signature &sig, const std::string &owner) noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+    };
+}
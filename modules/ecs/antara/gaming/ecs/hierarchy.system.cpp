@@ -0,0 +1,206 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C System Headers
+#include <cmath> ///< std::cos, std::sin
+
+//! Dependencies Headers
+#include <loguru.hpp> ///< VLOG_F
+
+//! SDK Headers
+#include "antara/gaming/ecs/hierarchy.system.hpp"
+#include "antara/gaming/math/utility.hpp" ///< math::RAD2DEG
+
+//! Anonymous Implementation
+namespace {
+    std::size_t index_of(entt::entity entity) noexcept {
+        return static_cast<std::size_t>(entt::registry::entity(entity));
+    }
+
+    antara::gaming::math::vec2f rotate(antara::gaming::math::vec2f vec, float degree) noexcept {
+        if (degree == 0.f) {
+            return vec;
+        }
+        const float rad = degree / antara::gaming::math::RAD2DEG;
+        const float cos = std::cos(rad);
+        const float sin = std::sin(rad);
+        return {vec.x() * cos - vec.y() * sin, vec.x() * sin + vec.y() * cos};
+    }
+}
+
+//! Private implementation
+namespace antara::gaming::ecs {
+    hierarchy_system::entity_state &hierarchy_system::state_(entt::entity entity) noexcept {
+        const auto idx = index_of(entity);
+        if (idx >= states_.size()) {
+            states_.resize(idx + 1);
+        }
+        return states_[idx];
+    }
+
+    bool hierarchy_system::is_linked_(entt::entity entity) const noexcept {
+        const auto idx = index_of(entity);
+        return idx < states_.size() && (states_[idx].is_parent || states_[idx].parent != entt::null);
+    }
+
+    void hierarchy_system::sort_() noexcept {
+        auto view = entity_registry_.view<transform::parent_2d>();
+        for (auto &&state : states_) {
+            state.is_parent = false;
+        }
+        for (auto entity : view) {
+            auto &link = view.get(entity);
+            std::uint32_t depth = 1u;
+            for (auto current = link.entity; entity_registry_.valid(current) &&
+                                             entity_registry_.has<transform::parent_2d>(current);) {
+                current = entity_registry_.get<transform::parent_2d>(current).entity;
+                if (++depth > view.size()) {
+                    VLOG_F(loguru::Verbosity_ERROR, "cycle in the hierarchy of entity {}", index_of(entity));
+                    break;
+                }
+            }
+            link.depth = depth;
+            state_(entity).parent = link.entity;
+            if (link.entity != entt::null) {
+                state_(link.entity).is_parent = true;
+            }
+        }
+        entity_registry_.sort<transform::parent_2d>([](const auto &lhs, const auto &rhs) {
+            return lhs.depth < rhs.depth;
+        });
+        nb_children_ = view.size();
+        need_sort_ = false;
+    }
+}
+
+//! Public implementation
+namespace antara::gaming::ecs {
+    hierarchy_system::hierarchy_system(entt::registry &registry) noexcept : system(registry) {
+        registry.on_construct<transform::parent_2d>().connect<&hierarchy_system::on_parent_construct>(*this);
+        registry.on_replace<transform::parent_2d>().connect<&hierarchy_system::on_parent_replace>(*this);
+        registry.on_construct<transform::position_2d>().connect<&hierarchy_system::on_position_changed>(*this);
+        registry.on_replace<transform::position_2d>().connect<&hierarchy_system::on_position_changed>(*this);
+        registry.on_construct<transform::properties>().connect<&hierarchy_system::on_properties_changed>(*this);
+        registry.on_replace<transform::properties>().connect<&hierarchy_system::on_properties_changed>(*this);
+    }
+
+    hierarchy_system::~hierarchy_system() noexcept {
+        entity_registry_.on_construct<transform::parent_2d>().disconnect(*this);
+        entity_registry_.on_replace<transform::parent_2d>().disconnect(*this);
+        entity_registry_.on_construct<transform::position_2d>().disconnect(*this);
+        entity_registry_.on_replace<transform::position_2d>().disconnect(*this);
+        entity_registry_.on_construct<transform::properties>().disconnect(*this);
+        entity_registry_.on_replace<transform::properties>().disconnect(*this);
+    }
+
+    void hierarchy_system::update() noexcept {
+        auto view = entity_registry_.view<transform::parent_2d>();
+        if (need_sort_ || view.size() != nb_children_) {
+            sort_();
+        }
+        ++pass_;
+        nb_updated_ = 0u;
+        updating_ = true;
+        for (auto entity : view) {
+            const auto &link = view.get(entity);
+            if (not entity_registry_.valid(link.entity)) {
+                continue;
+            }
+            const auto parent_state = state_(link.entity);
+            auto &state = state_(entity);
+            if (not state.dirty && not parent_state.dirty && parent_state.moved_pass != pass_) {
+                continue;
+            }
+
+            math::vec2f parent_position = math::vec2f::scalar(0.f);
+            math::vec2f parent_scale = math::vec2f::scalar(1.f);
+            float parent_rotation = 0.f;
+            if (auto pos = entity_registry_.try_get<transform::position_2d>(link.entity); pos != nullptr) {
+                parent_position = *pos;
+            }
+            if (auto props = entity_registry_.try_get<transform::properties>(link.entity); props != nullptr) {
+                parent_scale = props->scale;
+                parent_rotation = props->rotation;
+            }
+
+            state.moved_pass = pass_;
+            ++nb_updated_;
+            entity_registry_.assign_or_replace<transform::position_2d>(entity, parent_position +
+                                                                               rotate(link.local_position * parent_scale,
+                                                                                      parent_rotation));
+            if (auto props = entity_registry_.try_get<transform::properties>(entity); props != nullptr) {
+                transform::properties world_props = *props;
+                world_props.scale = parent_scale * link.local_scale;
+                world_props.rotation = parent_rotation + link.local_rotation;
+                entity_registry_.replace<transform::properties>(entity, world_props);
+            }
+        }
+        updating_ = false;
+        for (auto entity : dirty_entities_) {
+            state_(entity).dirty = false;
+        }
+        dirty_entities_.clear();
+    }
+
+    void hierarchy_system::mark_dirty(entt::entity entity) noexcept {
+        if (updating_) {
+            return;
+        }
+        auto &state = state_(entity);
+        if (not state.dirty) {
+            state.dirty = true;
+            dirty_entities_.push_back(entity);
+        }
+    }
+
+    std::size_t hierarchy_system::nb_updated() const noexcept {
+        return nb_updated_;
+    }
+
+    void hierarchy_system::on_parent_construct(entt::entity entity, entt::registry &,
+                                               transform::parent_2d &parent) noexcept {
+        need_sort_ = true;
+        state_(entity).parent = parent.entity;
+        if (parent.entity != entt::null) {
+            state_(parent.entity).is_parent = true;
+        }
+        mark_dirty(entity);
+    }
+
+    void hierarchy_system::on_parent_replace(entt::entity entity, entt::registry &,
+                                             transform::parent_2d &parent) noexcept {
+        if (state_(entity).parent != parent.entity) {
+            need_sort_ = true;
+            state_(entity).parent = parent.entity;
+            if (parent.entity != entt::null) {
+                state_(parent.entity).is_parent = true;
+            }
+        }
+        mark_dirty(entity);
+    }
+
+    void hierarchy_system::on_position_changed(entt::entity entity, entt::registry &, transform::position_2d &) noexcept {
+        if (is_linked_(entity)) {
+            mark_dirty(entity);
+        }
+    }
+
+    void hierarchy_system::on_properties_changed(entt::entity entity, entt::registry &, transform::properties &) noexcept {
+        if (is_linked_(entity)) {
+            mark_dirty(entity);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry
+
+//! SDK Headers
+#include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
+#include "antara/gaming/ecs/system.hpp" ///< ecs::system
+#include "antara/gaming/transform/component.hierarchy.hpp" ///< transform::parent_2d
+#include "antara/gaming/transform/component.position.hpp" ///< transform::position_2d
+#include "antara/gaming/transform/component.properties.hpp" ///< transform::properties
+
+namespace antara::gaming::ecs {
+    /**
+     * @class hierarchy_system
+     * @brief Compute the world transform (position_2d, properties) of every entity with a transform::parent_2d.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The parent_2d storage is kept sorted by depth, so parents always come before their children and the world
+     *         transforms are computed in one linear pass. The storage is only sorted again when the hierarchy changes.
+     *         Only dirty subtrees are recomputed: a child is dirty when its parent_2d is replaced or when the world transform
+     *         of its parent changed. World transforms are written with `registry.replace`, so the rendering and the global bounds follow.
+     * @endverbatim
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. warning::
+     *         Changes are detected through the registry signals, a root moved in place through `registry.get` has to be flagged with mark_dirty.
+     *         Create it after the logic systems which move the roots, so the children follow within the same tick.
+     * @endverbatim
+     */
+    class hierarchy_system final : public ecs::logic_update_system<hierarchy_system> {
+        //! Private typedefs
+        struct entity_state {
+            entt::entity parent{entt::null};
+            std::uint64_t moved_pass{0u};
+            bool is_parent{false};
+            bool dirty{false};
+        };
+
+        //! Private fields
+        std::vector<entity_state> states_; ///< indexed by entity identifier
+        std::vector<entt::entity> dirty_entities_;
+        std::uint64_t pass_{0u};
+        std::size_t nb_children_{0u};
+        std::size_t nb_updated_{0u};
+        bool need_sort_{true};
+        bool updating_{false};
+
+        //! Private member functions
+        entity_state &state_(entt::entity entity) noexcept;
+
+        [[nodiscard]] bool is_linked_(entt::entity entity) const noexcept;
+
+        void sort_() noexcept;
+
+    public:
+        //! Constructors
+        hierarchy_system(entt::registry &registry) noexcept;
+
+        ~hierarchy_system() noexcept final;
+
+        //! Public member functions
+        void update() noexcept final;
+
+        /// @brief recompute the subtree of the entity at the next update, for transforms modified in place.
+        void mark_dirty(entt::entity entity) noexcept;
+
+        /// @return number of world transforms recomputed by the last update
+        [[nodiscard]] std::size_t nb_updated() const noexcept;
+
+        //! Callbacks
+        void on_parent_construct(entt::entity entity, entt::registry &registry, transform::parent_2d &parent) noexcept;
+
+        void on_parent_replace(entt::entity entity, entt::registry &registry, transform::parent_2d &parent) noexcept;
+
+        void on_position_changed(entt::entity entity, entt::registry &registry, transform::position_2d &pos) noexcept;
+
+        void on_properties_changed(entt::entity entity, entt::registry &registry, transform::properties &props) noexcept;
+    };
+}
+
+REFL_AUTO(type(antara::gaming::ecs::hierarchy_system))
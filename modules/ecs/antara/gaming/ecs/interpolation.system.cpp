@@ -14,19 +14,75 @@
  *                                                                            *
  ******************************************************************************/
 
-//! Dependencies Headers
-#include <entt/entity/helper.hpp> ///< entt::tag
+//! C++ System Headers
+#include <algorithm> ///< std::copy_n
+#include <type_traits> ///< std::is_standard_layout_v
 
 //! SDK Headers
 #include "antara/gaming/ecs/interpolation.system.hpp"
-#include "antara/gaming/transform/component.position.hpp" ///< transform::position_2d,previous_position2d
+#include "antara/gaming/math/batch.hpp" ///< math::lerp_n
+#include "antara/gaming/transform/component.position.hpp" ///< transform::position_2d, previous_position_2d, interpolated_position_2d
+
+namespace {
+    using namespace antara::gaming::transform;
+
+    static_assert(sizeof(position_2d) == 2 * sizeof(float), "position_2d must be layout compatible with float[2]");
+    static_assert(sizeof(previous_position_2d) == sizeof(position_2d));
+    static_assert(sizeof(interpolated_position_2d) == sizeof(position_2d));
+    static_assert(sizeof(antara::gaming::math::vec2f) == 2 * sizeof(float) &&
+                  std::is_standard_layout_v<antara::gaming::math::vec2f>,
+                  "vec2f must be layout compatible with float[2], the batched passes work on raw float arrays");
+
+    using dynamic_tag = entt::tag<"dynamic"_hs>;
+
+    void on_position_build(entt::entity ett, entt::registry &reg, position_2d &pos) noexcept {
+        //! pos may move when the dynamic group takes the entity, keep a copy
+        const antara::gaming::math::vec2f value = pos;
+        reg.assign<previous_position_2d>(ett, value);
+        if (reg.has<dynamic_tag>(ett)) {
+            reg.assign<interpolated_position_2d>(ett, value);
+        }
+    }
+
+    void on_dynamic_construct(entt::entity ett, entt::registry &reg, const dynamic_tag &) noexcept {
+        if (auto pos = reg.try_get<position_2d>(ett); pos != nullptr) {
+            reg.assign_or_replace<interpolated_position_2d>(ett, static_cast<antara::gaming::math::vec2f>(*pos));
+        }
+    }
+
+    void on_dynamic_destroy(entt::entity ett, entt::registry &reg) noexcept {
+        if (reg.has<interpolated_position_2d>(ett)) {
+            reg.remove<interpolated_position_2d>(ett);
+        }
+    }
+}
 
 namespace antara::gaming::ecs {
     void interpolation_system::update() noexcept {
-        using namespace transform;
-        auto func = [](position_2d &pos, previous_position_2d &previous_pos) { previous_pos = pos; };
-        entity_registry_.view<entt::tag<"dynamic"_hs>, position_2d, previous_position_2d>().less(func);
+        auto group = dynamic_group::get(entity_registry_);
+        if (group.empty()) {
+            return;
+        }
+        const float *current = group.raw<transform::position_2d>()->data();
+        float *previous = group.raw<transform::previous_position_2d>()->data();
+        std::copy_n(current, group.size() * 2u, previous);
+    }
+
+    void interpolation_system::interpolate(entt::registry &registry, float interpolation) noexcept {
+        auto group = dynamic_group::get(registry);
+        if (group.empty()) {
+            return;
+        }
+        math::lerp_n(group.raw<transform::previous_position_2d>()->data(), group.raw<transform::position_2d>()->data(),
+                     group.raw<transform::interpolated_position_2d>()->data(), group.size() * 2u, interpolation);
     }
 
-    interpolation_system::interpolation_system(entt::registry &registry) noexcept : system(registry) {}
-}
\ No newline at end of file
+    void interpolation_system::connect_positions(entt::registry &registry) noexcept {
+        registry.on_construct<transform::position_2d>().connect<&on_position_build>();
+        registry.on_construct<dynamic_tag>().connect<&on_dynamic_construct>();
+        registry.on_destroy<dynamic_tag>().connect<&on_dynamic_destroy>();
+    }
+
+    interpolation_system::interpolation_system(entt::registry &registry) noexcept : system(registry) {
+    }
+}
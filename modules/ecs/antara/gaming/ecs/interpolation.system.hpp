@@ -17,23 +17,61 @@
 #pragma once
 
 //! Dependencies Headers
+#include <entt/entity/helper.hpp> ///< entt::tag
 #include <entt/entity/registry.hpp> ///< entt::registry
+#include <meta/sequence/list.hpp> ///< doom::meta::list
 #include <st/type.hpp> ///< st::type
 
 //! SDK Headers
 #include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
+#include "antara/gaming/ecs/group.declaration.hpp" ///< ecs::group_declaration
 #include "antara/gaming/ecs/system.hpp" ///< ecs::system
+#include "antara/gaming/transform/component.position.hpp" ///< transform::position_2d, previous_position_2d, interpolated_position_2d
 
 namespace antara::gaming::ecs {
     struct interpolation_system final : ecs::logic_update_system<interpolation_system> {
         //! Typedefs
         using st_interpolation = st::type<float, struct interpolation_tag>;
 
+        //! Dynamic entities, the three position pools are packed and aligned
+        //! Other groups owning position_2d must be nested in this one, so position_2d + properties stays a view
+        using dynamic_group = group_declaration<
+                doom::meta::list<transform::position_2d, transform::previous_position_2d, transform::interpolated_position_2d>,
+                doom::meta::list<entt::tag<"dynamic"_hs>>>;
+
+        using owned_groups = doom::meta::list<dynamic_group>;
+
         //! Constructor
         interpolation_system(entt::registry &registry) noexcept;
 
         //! Public member functions
         void update() noexcept final;
+
+        /**
+         * @brief write transform::interpolated_position_2d of every dynamic entity in one batched pass.
+         * @param registry registry holding the dynamic entities
+         * @param interpolation interpolation factor of the frame (st_interpolation)
+         *
+         * @verbatim embed:rst:leading-asterisk
+         *      .. note::
+         *         Dynamic entities live in dynamic_group, which owns position_2d, previous_position_2d and interpolated_position_2d,
+         *         so the three pools are contiguous and aligned: the pass is a single lerp over raw float arrays.
+         *         Being owned by the group, a position_2d reference may be invalidated when the dynamic tag is assigned.
+         * @endverbatim
+         */
+        static void interpolate(entt::registry &registry, float interpolation) noexcept;
+
+        /**
+         * @brief keep the position pools of an entity in sync with its transform::position_2d and its dynamic tag.
+         * @param registry registry to connect to
+         *
+         * @verbatim embed:rst:leading-asterisk
+         *      .. note::
+         *         Every positioned entity gets a previous_position_2d, only dynamic entities get an interpolated_position_2d:
+         *         static entities are drawn from their position_2d and never go stale when they are moved by hand.
+         * @endverbatim
+         */
+        static void connect_positions(entt::registry &registry) noexcept;
     };
 }
 
@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <algorithm> ///< std::max
+
+//! SDK Headers
+#include "antara/gaming/ecs/parallel.for.each.hpp"
+
+namespace antara::gaming::ecs {
+    std::size_t chunk_size_for(std::size_t nb_entities, std::size_t concurrency, const chunking &cfg) noexcept {
+        const auto nb_target_chunks = std::max<std::size_t>(concurrency * cfg.chunks_per_thread, 1u);
+        auto chunk_size = std::max((nb_entities + nb_target_chunks - 1u) / nb_target_chunks, cfg.min_chunk_size);
+        chunk_size = std::max<std::size_t>(chunk_size, 1u);
+        return (chunk_size + cache_line_size - 1u) / cache_line_size * cache_line_size;
+    }
+
+    std::size_t deferred_commands::begin_pass(std::size_t nb_chunks) noexcept {
+        //! queues are only cleared by flush, the commands of a previous pass are kept
+        const auto first_queue = nb_used_chunks_;
+        nb_used_chunks_ += nb_chunks;
+        if (chunks_.size() < nb_used_chunks_) {
+            chunks_.resize(nb_used_chunks_);
+        }
+        return first_queue;
+    }
+
+    void deferred_commands::flush(entt::registry &registry) noexcept {
+        for (std::size_t idx = 0u; idx < nb_used_chunks_; ++idx) {
+            for (auto &&cmd : chunks_[idx].value) {
+                cmd(registry);
+            }
+            chunks_[idx].value.clear();
+        }
+        nb_used_chunks_ = 0u;
+    }
+
+    std::size_t deferred_commands::size() const noexcept {
+        std::size_t nb_commands = 0u;
+        for (auto &&chunk : chunks_) {
+            nb_commands += chunk.value.size();
+        }
+        return nb_commands;
+    }
+}
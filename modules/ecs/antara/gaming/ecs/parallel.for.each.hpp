@@ -0,0 +1,228 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+
+//! C++ System Headers
+#include <algorithm> ///< std::min, std::max
+#include <functional> ///< std::function
+#include <type_traits> ///< std::is_invocable_v
+#include <utility> ///< std::declval, std::forward, std::pair
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry, entt::entity
+#include <meta/detection/detection.hpp> ///< doom::meta::is_detected
+
+//! SDK Headers
+#include "antara/gaming/ecs/worker.pool.hpp" ///< ecs::worker_pool
+
+namespace antara::gaming::ecs {
+    //! Size of a cache line, chunks and per chunk slots are laid out on this boundary to avoid false sharing
+    inline constexpr std::size_t cache_line_size = 64u;
+
+    template<typename T>
+    struct alignas(cache_line_size) padded {
+        T value;
+    };
+
+    /**
+     * @struct chunking
+     * @brief How a view is split into chunks by parallel_for_each.
+     */
+    struct chunking {
+        std::size_t min_chunk_size{1024u}; ///< smaller chunks aren't worth the scheduling
+        std::size_t chunks_per_thread{4u}; ///< more chunks than threads to balance uneven work
+    };
+
+    /**
+     * @return number of entities per chunk, a multiple of cache_line_size so that two chunks never write in the same
+     * cache line of a packed pool whose components are a power of two no larger than a cache line.
+     */
+    std::size_t chunk_size_for(std::size_t nb_entities, std::size_t concurrency, const chunking &cfg) noexcept;
+
+    /**
+     * @class deferred_commands
+     * @brief Structural changes (create, destroy, assign, remove) queued during a parallel section.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Every chunk owns its queue, flush() replays them in chunk order: the result does not depend on the
+     *         scheduling of the chunks. Several passes can be queued before a flush, each one appends its own queues.
+     * @endverbatim
+     */
+    class deferred_commands {
+        //! Private typedefs
+        using command = std::function<void(entt::registry &)>;
+
+        //! Private fields
+        std::vector<padded<std::vector<command>>> chunks_;
+        std::size_t nb_used_chunks_{0u};
+    public:
+        /**
+         * @brief prepare one queue per chunk after the queues of the previous passes, called by parallel_for_each.
+         * @return index of the first queue of the pass, given to the chunk_context
+         */
+        std::size_t begin_pass(std::size_t nb_chunks) noexcept;
+
+        template<typename TCommand>
+        void push(std::size_t chunk_index, TCommand &&cmd) noexcept {
+            chunks_[chunk_index].value.emplace_back(std::forward<TCommand>(cmd));
+        }
+
+        /// @brief apply the queued commands to the registry, outside of the parallel section.
+        void flush(entt::registry &registry) noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+    };
+
+    /**
+     * @struct chunk_context
+     * @brief Given to the functors of parallel_for_each which take it as second parameter.
+     */
+    struct chunk_context {
+        std::size_t index;
+        deferred_commands *commands{nullptr};
+        std::size_t first_queue{0u}; ///< offset of the pass in the deferred_commands
+
+        /// @brief queue a structural change, it will be applied by deferred_commands::flush
+        template<typename TCommand>
+        void defer(TCommand &&cmd) noexcept {
+            commands->push(first_queue + index, std::forward<TCommand>(cmd));
+        }
+    };
+
+    namespace details {
+        template<typename TView>
+        using view_data_t = decltype(std::declval<const TView &>().data());
+
+        /// @return contiguous entities of the view, copied in storage when the view doesn't expose them
+        template<typename TView>
+        std::pair<const entt::entity *, std::size_t>
+        entities_of(const TView &view, std::vector<entt::entity> &storage) noexcept {
+            if constexpr (doom::meta::is_detected_v<view_data_t, TView>) {
+                return {view.data(), view.size()};
+            } else {
+                storage.assign(view.begin(), view.end());
+                return {storage.data(), storage.size()};
+            }
+        }
+
+        template<typename TFunctor>
+        void invoke(TFunctor &functor, entt::entity entity, chunk_context &ctx) noexcept {
+            if constexpr (std::is_invocable_v<TFunctor &, entt::entity, chunk_context &>) {
+                functor(entity, ctx);
+            } else {
+                functor(entity);
+            }
+        }
+
+        template<typename TView, typename TFunctor>
+        void parallel_for_each(const TView &view, TFunctor &functor, deferred_commands *commands, worker_pool &pool,
+                               const chunking &cfg) noexcept {
+            std::vector<entt::entity> storage;
+            const auto[entities, nb_entities] = entities_of(view, storage);
+            if (nb_entities == 0u) {
+                return;
+            }
+            const auto chunk_size = chunk_size_for(nb_entities, pool.concurrency(), cfg);
+            const auto nb_chunks = (nb_entities + chunk_size - 1u) / chunk_size;
+            const auto first_queue = commands != nullptr ? commands->begin_pass(nb_chunks) : 0u;
+            pool.run(nb_chunks, [&, entities = entities, nb_entities = nb_entities](std::size_t chunk_index) {
+                chunk_context ctx{chunk_index, commands, first_queue};
+                const auto last = std::min(nb_entities, (chunk_index + 1u) * chunk_size);
+                for (auto idx = chunk_index * chunk_size; idx < last; ++idx) {
+                    invoke(functor, entities[idx], ctx);
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief call functor(entity) for every entity of a view or a group, across a worker_pool.
+     * @param view entt view or group, single component views and groups are split without any copy.
+     * @param functor called concurrently, it must only touch the components of its own entity.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. warning::
+     *         Structural changes of the registry are forbidden inside the functor, use the deferred_commands overload.
+     * @endverbatim
+     *
+     * **Example:**
+     * @code{.cpp}
+     *          auto view = registry.view<position_2d, velocity>();
+     *          ecs::parallel_for_each(view, [&view](entt::entity entity) {
+     *              view.get<position_2d>(entity) += view.get<velocity>(entity);
+     *          });
+     * @endcode
+     */
+    template<typename TView, typename TFunctor>
+    void parallel_for_each(const TView &view, TFunctor &&functor, worker_pool &pool = worker_pool::shared(),
+                           const chunking &cfg = {}) noexcept {
+        details::parallel_for_each(view, functor, nullptr, pool, cfg);
+    }
+
+    /**
+     * @overload parallel_for_each
+     * @brief functor(entity, chunk_context &) may queue structural changes with chunk_context::defer, they are applied by
+     * commands.flush(registry) once the parallel section is over.
+     */
+    template<typename TView, typename TFunctor>
+    void parallel_for_each(const TView &view, deferred_commands &commands, TFunctor &&functor,
+                           worker_pool &pool = worker_pool::shared(), const chunking &cfg = {}) noexcept {
+        details::parallel_for_each(view, functor, &commands, pool, cfg);
+    }
+
+    /**
+     * @brief deterministic map/reduce over a view or a group.
+     * @param identity neutral element of reduce
+     * @param map called concurrently, map(entity) -> T
+     * @param reduce associative, reduce(T, T) -> T
+     * @param chunk_size entities per chunk, rounded up to a multiple of cache_line_size
+     * @return the reduction of every mapped entity
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Chunks are sized independently of the number of threads and their partial results are combined in chunk
+     *         order, the result is the same for any pool (including floating point sums).
+     * @endverbatim
+     */
+    template<typename T, typename TView, typename TMap, typename TReduce>
+    T parallel_reduce(const TView &view, T identity, TMap &&map, TReduce &&reduce,
+                      worker_pool &pool = worker_pool::shared(), std::size_t chunk_size = 1024u) noexcept {
+        std::vector<entt::entity> storage;
+        const auto[entities, nb_entities] = details::entities_of(view, storage);
+        chunk_size = (std::max<std::size_t>(chunk_size, 1u) + cache_line_size - 1u) / cache_line_size * cache_line_size;
+        const auto nb_chunks = (nb_entities + chunk_size - 1u) / chunk_size;
+        std::vector<padded<T>> partials(nb_chunks, padded<T>{identity});
+        pool.run(nb_chunks, [&, entities = entities, nb_entities = nb_entities](std::size_t chunk_index) {
+            T partial = identity;
+            const auto last = std::min(nb_entities, (chunk_index + 1u) * chunk_size);
+            for (auto idx = chunk_index * chunk_size; idx < last; ++idx) {
+                partial = reduce(partial, map(entities[idx]));
+            }
+            partials[chunk_index].value = partial;
+        });
+        T result = identity;
+        for (auto &&partial : partials) {
+            result = reduce(result, partial.value);
+        }
+        return result;
+    }
+}
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <utility> ///< std::swap
+
+//! Dependencies Headers
+#include <entt/entity/helper.hpp> ///< entt::tag
+
+//! SDK Headers
+#include "antara/gaming/ecs/render.snapshot.hpp"
+#include "antara/gaming/graphics/component.layer.hpp" ///< graphics::draw_order
+#include "antara/gaming/transform/component.position.hpp" ///< transform::position_2d, transform::previous_position_2d
+
+//! Anonymous Implementation
+namespace {
+    using namespace antara::gaming::transform;
+    using namespace entt;
+
+    void fill_snapshot(registry &reg, antara::gaming::ecs::render_snapshot &snapshot) noexcept {
+        using antara::gaming::graphics::draw_order;
+        reg.view<draw_order>().each([&reg, &snapshot](entity ett, draw_order &order) {
+            using antara::gaming::math::vec2f;
+            //! drawables without position (eg: a vertex_array in world coordinates) are kept where they are
+            auto pos = reg.try_get<position_2d>(ett);
+            if (pos == nullptr) {
+                snapshot.entries.push_back({ett, vec2f::scalar(0.f), vec2f::scalar(0.f), order.layer, false, order.depth});
+                return;
+            }
+            auto prev_pos = reg.try_get<previous_position_2d>(ett);
+            vec2f cur = *pos;
+            vec2f prev = prev_pos != nullptr ? static_cast<vec2f>(*prev_pos) : cur;
+            snapshot.entries.push_back(
+                    {ett, cur, prev, order.layer, reg.has<tag<"dynamic"_hs>>(ett), order.depth});
+        });
+    }
+}
+
+namespace antara::gaming::ecs {
+    math::vec2f render_snapshot::entry::interpolated_position(float interp) const noexcept {
+        if (not is_dynamic || previous_position == position) {
+            return position;
+        }
+        return previous_position + (position - previous_position) * interp;
+    }
+
+    void render_snapshot::clear() noexcept {
+        entries.clear();
+        interpolation = 0.f;
+    }
+
+    render_snapshot &render_snapshot_buffer::back() noexcept {
+        return back_;
+    }
+
+    void render_snapshot_buffer::publish() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(back_, front_);
+            fresh_ = true;
+        }
+        cv_.notify_one();
+    }
+
+    void render_snapshot_buffer::produce(entt::registry &registry, float interpolation) noexcept {
+        //! back_ is only touched by the producer, publish() is the only synchronisation point
+        back_.clear();
+        back_.interpolation = interpolation;
+        back_.frame_id = ++last_frame_id_;
+        fill_snapshot(registry, back_);
+        publish();
+    }
+
+    bool render_snapshot_buffer::try_acquire(render_snapshot &out) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (not fresh_) {
+            return false;
+        }
+        std::swap(out, front_);
+        fresh_ = false;
+        return true;
+    }
+
+    bool render_snapshot_buffer::wait_acquire(render_snapshot &out) noexcept {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return fresh_ || closed_; });
+        if (not fresh_) {
+            return false;
+        }
+        std::swap(out, front_);
+        fresh_ = false;
+        return true;
+    }
+
+    void render_snapshot_buffer::close() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        cv_.notify_all();
+    }
+}
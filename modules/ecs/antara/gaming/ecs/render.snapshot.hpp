@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <condition_variable> ///< std::condition_variable
+#include <mutex> ///< std::mutex, std::unique_lock
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry, entt::entity
+
+//! SDK Headers
+#include "antara/gaming/math/vector.hpp" ///< math::vec2f
+
+namespace antara::gaming::ecs {
+    /**
+     * @struct render_snapshot
+     * @brief Immutable copy of the drawable state of a frame, produced by the system_manager once the logic ticks are done.
+     * @note entries are in storage order, layer and depth are given to sort them in a graphics::render_queue.
+     */
+    struct render_snapshot {
+        struct entry {
+            entt::entity entity{entt::null};
+            math::vec2f position{math::vec2f::scalar(0.f)};
+            math::vec2f previous_position{math::vec2f::scalar(0.f)};
+            std::size_t layer{0u};
+            bool is_dynamic{false};
+            float depth{0.f};
+
+            /**
+             * @param interpolation interpolation factor of the frame (st_interpolation)
+             * @return the position to draw, previous_position is lerped toward position for dynamic entities.
+             */
+            [[nodiscard]] math::vec2f interpolated_position(float interpolation) const noexcept;
+        };
+
+        //! Fields
+        std::vector<entry> entries;
+        float interpolation{0.f};
+        std::uint64_t frame_id{0ull};
+
+        void clear() noexcept;
+    };
+
+    /**
+     * @class render_snapshot_buffer
+     * @brief Double buffer of render_snapshot between the logic thread (producer) and a render thread (consumer).
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The system_manager produces a snapshot every frame as soon as this buffer is present in the registry context.
+     *         Snapshots are swapped, never copied: the producer fills back() then calls publish().
+     * @endverbatim
+     */
+    class render_snapshot_buffer {
+        //! Private fields
+        render_snapshot back_;
+        render_snapshot front_;
+        bool fresh_{false};
+        bool closed_{false};
+        std::uint64_t last_frame_id_{0ull};
+        std::mutex mutex_;
+        std::condition_variable cv_;
+    public:
+        //! Public member functions
+
+        /// @brief snapshot to fill from the producer side.
+        render_snapshot &back() noexcept;
+
+        /// @brief make the back snapshot available to the consumer.
+        void publish() noexcept;
+
+        /**
+         * @brief fill back() with the drawables (graphics::draw_order) of the registry, then publish it.
+         * @param registry registry holding the drawables
+         * @param interpolation interpolation factor of the frame (st_interpolation)
+         * @note this is the produce step of the system_manager and the static_system_pipeline.
+         */
+        void produce(entt::registry &registry, float interpolation) noexcept;
+
+        /**
+         * @brief swap the latest published snapshot into out without blocking.
+         * @return true if a new snapshot was available, false otherwise
+         */
+        bool try_acquire(render_snapshot &out) noexcept;
+
+        /**
+         * @brief block until a new snapshot is published or the buffer is closed.
+         * @return true if out contains a new snapshot, false if the buffer has been closed
+         */
+        bool wait_acquire(render_snapshot &out) noexcept;
+
+        /// @brief wake up and release every consumer waiting on the buffer.
+        void close() noexcept;
+    };
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! SDK Headers
+#include "antara/gaming/ecs/rollback.buffer.hpp"
+
+namespace antara::gaming::ecs {
+    rollback_buffer::rollback_buffer(std::size_t capacity) noexcept : capacity_(capacity) {
+    }
+
+    void rollback_buffer::capture(entt::registry &registry, std::uint64_t tick) noexcept {
+        if (not has_keyframe_ || tick != newest_tick() + 1u) {
+            //! first capture or a gap in the ticks: start over from a keyframe
+            for (auto &&history : histories_) {
+                history->capture(registry, true);
+            }
+            oldest_tick_ = tick;
+            nb_deltas_ = 0u;
+            has_keyframe_ = true;
+            return;
+        }
+        for (auto &&history : histories_) {
+            history->capture(registry, false);
+        }
+        if (++nb_deltas_ > capacity_) {
+            for (auto &&history : histories_) {
+                history->fold_oldest();
+            }
+            --nb_deltas_;
+            ++oldest_tick_;
+        }
+    }
+
+    bool rollback_buffer::restore(entt::registry &registry, std::uint64_t tick) noexcept {
+        if (not contains(tick)) {
+            return false;
+        }
+        const auto nb_deltas = static_cast<std::size_t>(tick - oldest_tick_);
+        for (auto &&history : histories_) {
+            history->restore(registry, nb_deltas);
+        }
+        nb_deltas_ = nb_deltas;
+        return true;
+    }
+
+    bool rollback_buffer::contains(std::uint64_t tick) const noexcept {
+        return has_keyframe_ && tick >= oldest_tick_ && tick <= newest_tick();
+    }
+
+    std::uint64_t rollback_buffer::oldest_tick() const noexcept {
+        return oldest_tick_;
+    }
+
+    std::uint64_t rollback_buffer::newest_tick() const noexcept {
+        return oldest_tick_ + nb_deltas_;
+    }
+
+    std::size_t rollback_buffer::capacity() const noexcept {
+        return capacity_;
+    }
+
+    std::size_t rollback_buffer::memory_usage() const noexcept {
+        std::size_t usage = 0u;
+        for (auto &&history : histories_) {
+            usage += history->memory_usage();
+        }
+        return usage;
+    }
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <deque> ///< std::deque
+#include <memory> ///< std::unique_ptr
+#include <type_traits> ///< std::is_trivially_copyable_v
+#include <unordered_map> ///< std::unordered_map
+#include <utility> ///< std::pair
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry, entt::entity
+#include <meta/sequence/list.hpp> ///< doom::meta::list
+
+namespace antara::gaming::ecs {
+    namespace details {
+        //! Type erased history of one component type
+        struct base_component_history {
+            virtual ~base_component_history() noexcept = default;
+
+            virtual void capture(entt::registry &registry, bool keyframe) noexcept = 0;
+
+            virtual void fold_oldest() noexcept = 0;
+
+            virtual void restore(entt::registry &registry, std::size_t nb_deltas) noexcept = 0;
+
+            [[nodiscard]] virtual std::size_t memory_usage() const noexcept = 0;
+        };
+
+        /**
+         * @class component_history
+         * @brief keyframe of a component at the oldest retained tick and one delta per tick after it.
+         */
+        template<typename TComponent>
+        class component_history final : public base_component_history {
+            static_assert(std::is_trivially_copyable_v<TComponent>, "rollback only tracks trivially copyable components");
+
+            //! Private typedefs
+            using state = std::unordered_map<entt::entity, TComponent>;
+
+            struct delta {
+                std::vector<std::pair<entt::entity, TComponent>> changed;
+                std::vector<entt::entity> removed;
+            };
+
+            //! Private fields
+            state keyframe_;
+            state current_;
+            std::deque<delta> deltas_;
+
+            static void apply_(state &target, const delta &dt) noexcept;
+
+        public:
+            void capture(entt::registry &registry, bool keyframe) noexcept final;
+
+            void fold_oldest() noexcept final;
+
+            void restore(entt::registry &registry, std::size_t nb_deltas) noexcept final;
+
+            [[nodiscard]] std::size_t memory_usage() const noexcept final;
+        };
+    }
+
+    /**
+     * @class rollback_buffer
+     * @brief Ring of the last logic ticks, used to rewind the simulation and resimulate it up to the present.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Set it in the registry context: the system_manager captures it after every logic tick, and
+     *         system_manager::resimulate_from(tick) restores a tick and replays the logic ticks up to the present.
+     *         Each capture only stores the components which changed since the previous tick, the oldest delta is folded
+     *         into a keyframe when the ring is full, so memory is bounded by the capacity.
+     *         Component values are rolled back, the entities themselves are not: an entity destroyed since the restored
+     *         tick is not recreated.
+     * @endverbatim
+     *
+     * **Example:**
+     * @code{.cpp}
+     *          auto &rollback = registry.set<ecs::rollback_buffer>(8u);
+     *          rollback.track<transform::position_2d, transform::previous_position_2d, velocity>();
+     *          // ... later, a late network input for a past tick arrives
+     *          system_manager.resimulate_from(input_tick);
+     * @endcode
+     */
+    class rollback_buffer {
+        //! Private fields
+        std::size_t capacity_;
+        std::uint64_t oldest_tick_{0u};
+        std::size_t nb_deltas_{0u};
+        bool has_keyframe_{false};
+        std::vector<std::unique_ptr<details::base_component_history>> histories_;
+    public:
+        //! Constructor
+
+        /// @param capacity number of ticks that can be rewound
+        explicit rollback_buffer(std::size_t capacity = 8u) noexcept;
+
+        //! Public member functions
+
+        /// @brief components to roll back, to declare before the first capture.
+        template<typename ... TComponents>
+        void track() noexcept;
+
+        template<typename ... TComponents>
+        void track(doom::meta::list<TComponents...>) noexcept;
+
+        /// @brief record the state of the tracked components at the given tick (ticks are captured in order).
+        void capture(entt::registry &registry, std::uint64_t tick) noexcept;
+
+        /**
+         * @brief write the tracked components back as they were at the given tick, later ticks are forgotten.
+         * @return false if the tick is not in the buffer anymore (or not yet)
+         */
+        bool restore(entt::registry &registry, std::uint64_t tick) noexcept;
+
+        [[nodiscard]] bool contains(std::uint64_t tick) const noexcept;
+
+        [[nodiscard]] std::uint64_t oldest_tick() const noexcept;
+
+        [[nodiscard]] std::uint64_t newest_tick() const noexcept;
+
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+        /// @return approximate number of bytes used by the keyframes and the deltas
+        [[nodiscard]] std::size_t memory_usage() const noexcept;
+    };
+}
+
+//! Implementation
+#include "antara/gaming/ecs/rollback.buffer.ipp"
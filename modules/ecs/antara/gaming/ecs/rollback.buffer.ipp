@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C++ System Headers
+#include <cstring> ///< std::memcmp
+
+namespace antara::gaming::ecs::details {
+    template<typename TComponent>
+    void component_history<TComponent>::apply_(state &target, const delta &dt) noexcept {
+        for (auto &&[entity, value] : dt.changed) {
+            target.insert_or_assign(entity, value);
+        }
+        for (auto &&entity : dt.removed) {
+            target.erase(entity);
+        }
+    }
+
+    template<typename TComponent>
+    void component_history<TComponent>::capture(entt::registry &registry, bool keyframe) noexcept {
+        auto view = registry.view<TComponent>();
+        if (keyframe) {
+            keyframe_.clear();
+            deltas_.clear();
+            for (auto entity : view) {
+                keyframe_.emplace(entity, view.get(entity));
+            }
+            current_ = keyframe_;
+            return;
+        }
+        delta dt;
+        for (auto entity : view) {
+            const auto &value = view.get(entity);
+            auto it = current_.find(entity);
+            if (it == current_.end()) {
+                current_.emplace(entity, value);
+                dt.changed.emplace_back(entity, value);
+            } else if (std::memcmp(&it->second, &value, sizeof(TComponent)) != 0) {
+                it->second = value;
+                dt.changed.emplace_back(entity, value);
+            }
+        }
+        if (current_.size() != view.size()) {
+            for (auto it = current_.begin(); it != current_.end();) {
+                if (not registry.valid(it->first) || not registry.has<TComponent>(it->first)) {
+                    dt.removed.push_back(it->first);
+                    it = current_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        deltas_.push_back(std::move(dt));
+    }
+
+    template<typename TComponent>
+    void component_history<TComponent>::fold_oldest() noexcept {
+        apply_(keyframe_, deltas_.front());
+        deltas_.pop_front();
+    }
+
+    template<typename TComponent>
+    void component_history<TComponent>::restore(entt::registry &registry, std::size_t nb_deltas) noexcept {
+        current_ = keyframe_;
+        for (std::size_t idx = 0u; idx < nb_deltas; ++idx) {
+            apply_(current_, deltas_[idx]);
+        }
+        deltas_.resize(nb_deltas);
+
+        std::vector<entt::entity> to_remove;
+        for (auto entity : registry.view<TComponent>()) {
+            if (current_.find(entity) == current_.end()) {
+                to_remove.push_back(entity);
+            }
+        }
+        for (auto entity : to_remove) {
+            registry.remove<TComponent>(entity);
+        }
+        for (auto &&[entity, value] : current_) {
+            if (registry.valid(entity)) {
+                registry.assign_or_replace<TComponent>(entity, value);
+            }
+        }
+    }
+
+    template<typename TComponent>
+    std::size_t component_history<TComponent>::memory_usage() const noexcept {
+        constexpr auto entry_size = sizeof(entt::entity) + sizeof(TComponent);
+        std::size_t usage = (keyframe_.size() + current_.size()) * entry_size;
+        for (auto &&dt : deltas_) {
+            usage += dt.changed.size() * entry_size + dt.removed.size() * sizeof(entt::entity);
+        }
+        return usage;
+    }
+}
+
+namespace antara::gaming::ecs {
+    template<typename... TComponents>
+    void rollback_buffer::track() noexcept {
+        (histories_.emplace_back(std::make_unique<details::component_history<TComponents>>()), ...);
+    }
+
+    template<typename... TComponents>
+    void rollback_buffer::track(doom::meta::list<TComponents...>) noexcept {
+        track<TComponents...>();
+    }
+}
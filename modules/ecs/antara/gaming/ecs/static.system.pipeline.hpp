@@ -0,0 +1,156 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <system_error> ///< std::make_error_code, std::errc
+#include <tuple> ///< std::tuple, std::get
+#include <type_traits> ///< std::is_same, std::is_base_of_v, std::disjunction_v, std::decay_t
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry
+#include <entt/signal/dispatcher.hpp> ///< entt::dispatcher
+
+//! SDK Headers
+#include "antara/gaming/ecs/group.declaration.hpp" ///< ecs::group_declarations
+#include "antara/gaming/ecs/interpolation.system.hpp" ///< ecs::interpolation_system
+#include "antara/gaming/ecs/render.snapshot.hpp" ///< ecs::render_snapshot_buffer
+#include "antara/gaming/ecs/system.hpp" ///< ecs::system
+#include "antara/gaming/ecs/system.type.hpp" ///< ecs::system_type
+#include "antara/gaming/event/event.bus.hpp" ///< event::event_bus
+#include "antara/gaming/event/fatal.error.hpp" ///< event::fatal_error
+#include "antara/gaming/graphics/component.layer.hpp" ///< graphics::connect_layers
+#include "antara/gaming/timer/time.step.hpp" ///< timer::time_step
+
+namespace antara::gaming::ecs {
+    /**
+     * @class static_system_pipeline
+     * @brief Compile-time counterpart of the system_manager for games whose set of systems is fixed.
+     * @tparam TSystems list of systems, as given to system_manager::load_systems, updated in this order inside their phase.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Systems are stored by value in a tuple and updated through a qualified call, so there is no virtual dispatch
+     *         and no per phase filtering: the update of each phase is unrolled at compile time.
+     *         Systems can still be enabled and disabled at runtime, they can't be added or removed.
+     *         Every system is constructed from the registry only, then its owning groups are declared as in the system_manager.
+     *         The time_step, the interpolation factor and the position/layer signals of the registry are shared with the system_manager,
+     *         a render snapshot is produced each frame the same way, so a threaded graphic system works with both.
+     * @endverbatim
+     *
+     * **Example:**
+     * @code{.cpp}
+     *          #include <entt/entity/registry.hpp>
+     *          #include <entt/dispatcher/dispatcher.hpp>
+     *          #include <antara/gaming/ecs/static.system.pipeline.hpp>
+     *
+     *          int main()
+     *          {
+     *              entt::registry entity_registry;
+     *              entity_registry.set<entt::dispatcher>();
+     *              antara::gaming::ecs::static_system_pipeline<my_game::input_system, my_game::physics_system> pipeline{entity_registry};
+     *              pipeline.start();
+     *              pipeline.disable_system<my_game::physics_system>();
+     *              std::size_t nb_systems_updated = pipeline.update();
+     *              return 0;
+     *          }
+     * @endcode
+     */
+    template<typename ... TSystems>
+    class static_system_pipeline {
+        static_assert((std::is_base_of_v<base_system, TSystems> && ...), "every system must derive from ecs::system");
+
+        //! Private typedefs
+        template<typename TSystem>
+        using registry_ref = entt::registry &;
+
+        //! Private member functions
+        template<system_type Phase, typename TSystem>
+        std::size_t update_system_(TSystem &sys) noexcept;
+
+        void declare_groups_(const base_system &sys) noexcept;
+
+        static entt::registry &connect_registry_(entt::registry &registry) noexcept;
+
+        void drain_events_() noexcept;
+
+        //! Private data members
+        entt::registry &entity_registry_;
+        timer::time_step &timestep_;
+        std::tuple<TSystems...> systems_;
+        group_declarations group_declarations_;
+        std::uint64_t logic_tick_{0u};
+        std::size_t next_tick_phase_{0u};
+        bool game_is_running_{false};
+    public:
+        //! Constructor
+        explicit static_system_pipeline(entt::registry &registry) noexcept;
+
+        //! Public static functions
+
+        /// @return number of systems of the pipeline, for all phases if sys_type is system_type::size
+        static constexpr std::size_t nb_systems(system_type sys_type = system_type::size) noexcept;
+
+        /// @return true if TSystem is part of the pipeline
+        template<typename TSystem>
+        static constexpr bool has_system() noexcept;
+
+        //! Public member functions
+
+        /// @brief same as system_manager::start, the update of the pipeline does nothing before it.
+        void start() noexcept;
+
+        /**
+         * @brief update the pipeline with the same logic as system_manager::update (pre_update, fixed logic ticks, post_update),
+         * the event::event_bus of the registry context is drained after each phase.
+         * @return number of systems which are successfully updated
+         */
+        std::size_t update() noexcept;
+
+        /**
+         * @tparam Phase kind of systems to update (pre_update, logic_update, post_update)
+         * @return number of systems which are successfully updated
+         */
+        template<system_type Phase>
+        std::size_t update_systems() noexcept;
+
+        template<typename TSystem>
+        TSystem &get_system() noexcept;
+
+        template<typename TSystem>
+        [[nodiscard]] const TSystem &get_system() const noexcept;
+
+        template<typename ... TSystemsToGet>
+        std::tuple<std::add_lvalue_reference_t<TSystemsToGet>...> get_systems() noexcept;
+
+        template<typename TSystem>
+        void enable_system() noexcept;
+
+        template<typename TSystem>
+        void disable_system() noexcept;
+
+        /// @return number of logic ticks performed since the pipeline was created
+        [[nodiscard]] std::uint64_t get_logic_tick() const noexcept;
+    };
+}
+
+//! Implementation
+#include "antara/gaming/ecs/static.system.pipeline.ipp"
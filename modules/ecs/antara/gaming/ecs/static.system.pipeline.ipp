@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+namespace antara::gaming::ecs {
+    template<typename... TSystems>
+    static_system_pipeline<TSystems...>::static_system_pipeline(entt::registry &registry) noexcept:
+            entity_registry_(connect_registry_(registry)),
+            timestep_(registry.try_ctx<timer::time_step>() != nullptr ? registry.ctx<timer::time_step>()
+                                                                      : registry.set<timer::time_step>()),
+            systems_{registry_ref<TSystems>(registry)...} {
+        std::apply([this](auto &&... sys) { (declare_groups_(sys), ...); }, systems_);
+    }
+
+    template<typename... TSystems>
+    constexpr std::size_t static_system_pipeline<TSystems...>::nb_systems(system_type sys_type) noexcept {
+        return ((sys_type == system_type::size || TSystems::get_system_type() == sys_type ? 1u : 0u) + ... + 0u);
+    }
+
+    template<typename... TSystems>
+    template<typename TSystem>
+    constexpr bool static_system_pipeline<TSystems...>::has_system() noexcept {
+        return std::disjunction_v<std::is_same<TSystem, TSystems>...>;
+    }
+
+    template<typename... TSystems>
+    void static_system_pipeline<TSystems...>::start() noexcept {
+        game_is_running_ = true;
+        timestep_.reset_lag();
+    }
+
+    template<typename... TSystems>
+    std::size_t static_system_pipeline<TSystems...>::update() noexcept {
+        if (not sizeof...(TSystems) || not game_is_running_)
+            return 0u;
+
+        std::size_t nb_systems_updated = 0u;
+        timestep_.start_frame();
+        nb_systems_updated += update_systems<system_type::pre_update>();
+        drain_events_();
+
+        while (timestep_.is_update_required()) {
+            nb_systems_updated += update_systems<system_type::logic_update>();
+            drain_events_();
+            ++logic_tick_;
+            timestep_.perform_update();
+        }
+
+        auto &interp = entity_registry_.ctx<interpolation_system::st_interpolation>();
+        interp = interpolation_system::st_interpolation{timestep_.get_interpolation()};
+        if constexpr (has_system<interpolation_system>()) {
+            interpolation_system::interpolate(entity_registry_, interp.value());
+        }
+        if (auto buffer = entity_registry_.try_ctx<render_snapshot_buffer>(); buffer != nullptr) {
+            buffer->produce(entity_registry_, interp.value());
+        }
+        nb_systems_updated += update_systems<system_type::post_update>();
+        drain_events_();
+
+        std::apply([](auto &&... sys) { (sys.std::decay_t<decltype(sys)>::post_update(), ...); }, systems_);
+        return nb_systems_updated;
+    }
+
+    template<typename... TSystems>
+    template<system_type Phase>
+    std::size_t static_system_pipeline<TSystems...>::update_systems() noexcept {
+        return std::apply([this](auto &&... sys) {
+            return (this->template update_system_<Phase>(sys) + ... + 0u);
+        }, systems_);
+    }
+
+    template<typename... TSystems>
+    template<system_type Phase, typename TSystem>
+    std::size_t static_system_pipeline<TSystems...>::update_system_(TSystem &sys) noexcept {
+        if constexpr (TSystem::get_system_type() == Phase) {
+            if (not sys.is_enabled()) {
+                return 0u;
+            }
+            if constexpr (Phase == system_type::logic_update) {
+                //! same cadence as system_manager::update_systems: staggered low-rate systems, substeps for high-rate ones
+                if (sys.get_tick_divisor() > 1u && not sys.has_tick_phase()) {
+                    sys.set_tick_phase(next_tick_phase_++);
+                }
+                if (not sys.is_due(logic_tick_)) {
+                    return 0u;
+                }
+            }
+            if (not sys.try_wake_up()) {
+                return 0u;
+            }
+            const std::size_t nb_substeps = Phase == system_type::logic_update ? sys.get_nb_substeps() : 1u;
+            for (std::size_t substep = 0u; substep < nb_substeps; ++substep) {
+                //! qualified call: resolved at compile time, no virtual dispatch
+                sys.TSystem::update();
+            }
+            if (sys.is_event_driven()) {
+                sys.sleep();
+            }
+            return 1u;
+        }
+        return 0u;
+    }
+
+    template<typename... TSystems>
+    void static_system_pipeline<TSystems...>::declare_groups_(const base_system &sys) noexcept {
+        for (auto &&sig : sys.get_group_signatures_rtti()) {
+            if (not group_declarations_.declare(entity_registry_, sig, sys.get_name())) {
+                entity_registry_.ctx<entt::dispatcher>().trigger<gaming::event::fatal_error>(
+                        std::make_error_code(std::errc::invalid_argument));
+            }
+        }
+    }
+
+    template<typename... TSystems>
+    entt::registry &static_system_pipeline<TSystems...>::connect_registry_(entt::registry &registry) noexcept {
+        //! connected before the systems are built, as the system_manager does before any system is loaded
+        interpolation_system::connect_positions(registry);
+        graphics::connect_layers(registry);
+        if (registry.try_ctx<interpolation_system::st_interpolation>() == nullptr) {
+            registry.set<interpolation_system::st_interpolation>(0.f);
+        }
+        return registry;
+    }
+
+    template<typename... TSystems>
+    void static_system_pipeline<TSystems...>::drain_events_() noexcept {
+        if (auto bus = entity_registry_.try_ctx<gaming::event::event_bus>(); bus != nullptr) {
+            bus->drain();
+        }
+    }
+
+    template<typename... TSystems>
+    template<typename TSystem>
+    TSystem &static_system_pipeline<TSystems...>::get_system() noexcept {
+        return std::get<TSystem>(systems_);
+    }
+
+    template<typename... TSystems>
+    template<typename TSystem>
+    const TSystem &static_system_pipeline<TSystems...>::get_system() const noexcept {
+        return std::get<TSystem>(systems_);
+    }
+
+    template<typename... TSystems>
+    template<typename... TSystemsToGet>
+    std::tuple<std::add_lvalue_reference_t<TSystemsToGet>...> static_system_pipeline<TSystems...>::get_systems() noexcept {
+        return {get_system<TSystemsToGet>()...};
+    }
+
+    template<typename... TSystems>
+    template<typename TSystem>
+    void static_system_pipeline<TSystems...>::enable_system() noexcept {
+        get_system<TSystem>().enable();
+    }
+
+    template<typename... TSystems>
+    template<typename TSystem>
+    void static_system_pipeline<TSystems...>::disable_system() noexcept {
+        get_system<TSystem>().disable();
+    }
+
+    template<typename... TSystems>
+    std::uint64_t static_system_pipeline<TSystems...>::get_logic_tick() const noexcept {
+        return logic_tick_;
+    }
+}
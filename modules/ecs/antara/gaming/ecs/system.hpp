@@ -19,6 +19,7 @@
 //! C++ System Headers
 #include <string> ///< std::string
 #include <type_traits> ///< std::is_same
+#include <vector> ///< std::vector
 
 //! Dependencies Headers
 #include <loguru.hpp> ///< LOG_SCOPE_FUNCTION, DVLOG_F
@@ -27,6 +28,7 @@
 #include "antara/gaming/core/safe.refl.hpp" ///< refl::reflect
 #include "antara/gaming/ecs/system.type.hpp" ///< ecs::st_system_logic[pre, post]_update
 #include "antara/gaming/ecs/base.system.hpp" ///< ecs::base_system
+#include "antara/gaming/ecs/wake.condition.hpp" ///< ecs::wake_on_events_t, ecs::wake_on_components_t
 
 namespace antara::gaming::ecs {
     template<typename TSystemDerived, typename TSystemType>
@@ -51,6 +53,12 @@ namespace antara::gaming::ecs {
          */
         static constexpr system_type get_system_type() noexcept;
 
+        /**
+         * \note this function allows you to retrieve the identifier used by the system_manager to index the system.
+         * \return system_id of the derived system.
+         */
+        static system_id get_system_id() noexcept;
+
         //! Public member functions
         /**
         * \note this function allows you to retrieve the type of a system at runtime.
@@ -58,11 +66,34 @@ namespace antara::gaming::ecs {
         */
         [[nodiscard]] system_type get_system_type_rtti() const noexcept final;
 
+        /**
+        * \note this function allows you to retrieve the identifier of a system at runtime.
+        * \return system_id of the derived system
+        */
+        [[nodiscard]] system_id get_system_id_rtti() const noexcept final;
+
+        /**
+        * \note this function allows you to retrieve the owning groups declared by the derived system through an
+        * owned_groups typedef (a doom::meta::list of group_declaration).
+        * \return signatures of the declared groups, empty if the derived system declares none.
+        */
+        [[nodiscard]] std::vector<group_signature> get_group_signatures_rtti() const noexcept final;
+
         /**
         * \note this function allow you to get the name of the derived system
         * \return name of the derived system.
         */
         [[nodiscard]] std::string get_name() const noexcept final;
+
+    private:
+        //! Private member functions
+        void connect_wake_conditions_(bool connect) noexcept;
+
+        template<typename ... TEvents>
+        void connect_wake_events_(doom::meta::list<TEvents...>, bool connect) noexcept;
+
+        template<typename ... TComponents>
+        void connect_wake_components_(doom::meta::list<TComponents...>, bool connect) noexcept;
     };
 }
 
@@ -22,6 +22,7 @@ namespace antara::gaming::ecs {
     system<TSystemDerived, TSystemType>::system(TArgs &&... args) noexcept : base_system(std::forward<TArgs>(args)...) {
         LOG_SCOPE_FUNCTION(INFO);
         DVLOG_F(loguru::Verbosity_INFO, "creating system {}", this->get_name());
+        connect_wake_conditions_(true);
     }
 
     template<typename TSystemDerived, typename TSystemType>
@@ -41,6 +42,21 @@ namespace antara::gaming::ecs {
         return system::get_system_type();
     }
 
+    template<typename TSystemDerived, typename TSystemType>
+    system_id system<TSystemDerived, TSystemType>::get_system_id() noexcept {
+        return system_id_of<TSystemDerived>();
+    }
+
+    template<typename TSystemDerived, typename TSystemType>
+    system_id system<TSystemDerived, TSystemType>::get_system_id_rtti() const noexcept {
+        return system::get_system_id();
+    }
+
+    template<typename TSystemDerived, typename TSystemType>
+    std::vector<group_signature> system<TSystemDerived, TSystemType>::get_group_signatures_rtti() const noexcept {
+        return group_signatures_of<TSystemDerived>();
+    }
+
     template<typename TSystemDerived, typename TSystemType>
     std::string system<TSystemDerived, TSystemType>::get_name() const noexcept {
         return system::get_class_name();
@@ -55,5 +71,46 @@ namespace antara::gaming::ecs {
     system<TSystemDerived, TSystemType>::~system() noexcept {
         LOG_SCOPE_FUNCTION(INFO);
         DVLOG_F(loguru::Verbosity_INFO, "destroying system {}", this->get_name());
+        connect_wake_conditions_(false);
+    }
+
+    template<typename TSystemDerived, typename TSystemType>
+    void system<TSystemDerived, TSystemType>::connect_wake_conditions_(bool connect) noexcept {
+        if constexpr (doom::meta::is_detected_v<wake_on_events_t, TSystemDerived>) {
+            connect_wake_events_(wake_on_events_t<TSystemDerived>{}, connect);
+        }
+        if constexpr (doom::meta::is_detected_v<wake_on_components_t, TSystemDerived>) {
+            connect_wake_components_(wake_on_components_t<TSystemDerived>{}, connect);
+        }
+        if constexpr (is_event_driven_v<TSystemDerived>) {
+            if (connect) {
+                this->set_event_driven(true);
+                this->sleep();
+            }
+        }
+    }
+
+    template<typename TSystemDerived, typename TSystemType>
+    template<typename ... TEvents>
+    void system<TSystemDerived, TSystemType>::connect_wake_events_(doom::meta::list<TEvents...>, bool connect) noexcept {
+        if (connect) {
+            (this->dispatcher_.template sink<TEvents>().template connect<&base_system::wake_up_on_event<TEvents>>(*this), ...);
+        } else {
+            (this->dispatcher_.template sink<TEvents>().template disconnect<&base_system::wake_up_on_event<TEvents>>(*this), ...);
+        }
+    }
+
+    template<typename TSystemDerived, typename TSystemType>
+    template<typename ... TComponents>
+    void
+    system<TSystemDerived, TSystemType>::connect_wake_components_(doom::meta::list<TComponents...>, bool connect) noexcept {
+        auto &registry = this->entity_registry_;
+        if (connect) {
+            (registry.template on_construct<TComponents>().template connect<&base_system::wake_up_on_component<TComponents>>(*this), ...);
+            (registry.template on_replace<TComponents>().template connect<&base_system::wake_up_on_component<TComponents>>(*this), ...);
+        } else {
+            (registry.template on_construct<TComponents>().template disconnect<&base_system::wake_up_on_component<TComponents>>(*this), ...);
+            (registry.template on_replace<TComponents>().template disconnect<&base_system::wake_up_on_component<TComponents>>(*this), ...);
+        }
     }
 }
\ No newline at end of file
@@ -22,43 +22,102 @@
 
 //! SDK Headers
 #include "antara/gaming/ecs/interpolation.system.hpp" ///< ecs::interpolation_system
+#include "antara/gaming/ecs/render.snapshot.hpp" ///< ecs::render_snapshot_buffer
 #include "antara/gaming/ecs/system.manager.hpp"
-#include "antara/gaming/transform/component.position.hpp" ///< transform::position_2d, transform::previous_position_2d
-
-//! Anonymous Implementation
-namespace {
-    using namespace antara::gaming::transform;
-    using namespace entt;
-
-    void on_position_build(entity ett, registry &reg, position_2d &pos) { reg.assign<previous_position_2d>(ett, pos); }
-}
+#include "antara/gaming/event/event.bus.hpp" ///< event::event_bus
+#include "antara/gaming/graphics/component.layer.hpp" ///< graphics::connect_layers
 
 //! Private implementation
 namespace antara::gaming::ecs {
     base_system &system_manager::add_system_(system_ptr &&system, system_type sys_type) noexcept {
         LOG_SCOPE_FUNCTION(INFO);
         DVLOG_F(loguru::Verbosity_INFO, "adding system {} in the system manager.", system->get_name());
-        return *systems_[sys_type].emplace_back(std::move(system));
+        declare_groups_(*system);
+        auto &added_system = *systems_[sys_type].emplace_back(std::move(system));
+        index_system_(added_system);
+        return added_system;
     }
 
     void system_manager::sweep_systems_() noexcept {
         using namespace ranges::actions;
         ranges::for_each(systems_, [](auto &&vec_system) { remove_if(vec_system, &base_system::is_marked); });
+        rebuild_systems_index_();
         need_to_sweep_systems_ = false;
     }
+
+    void system_manager::index_system_(base_system &system) noexcept {
+        const auto id = system.get_system_id_rtti();
+        if (id == invalid_system_id) {
+            return;
+        }
+        if (id >= systems_index_.size()) {
+            systems_index_.resize(id + 1, nullptr);
+        }
+        //! the first system of a given type stays the one returned by the lookups
+        if (systems_index_[id] == nullptr) {
+            systems_index_[id] = &system;
+        }
+    }
+
+    void system_manager::rebuild_systems_index_() noexcept {
+        std::fill(systems_index_.begin(), systems_index_.end(), nullptr);
+        for (auto &&current_sys_vec : systems_)
+            for (auto &&current_sys : current_sys_vec)
+                index_system_(*current_sys);
+    }
+
+    base_system *system_manager::find_system_(system_id id) const noexcept {
+        return id < systems_index_.size() ? systems_index_[id] : nullptr;
+    }
+
+    void system_manager::declare_groups_(const base_system &system) noexcept {
+        //! groups outlive the systems which declared them, so the declarations are never removed
+        for (auto &&sig : system.get_group_signatures_rtti()) {
+            if (not group_declarations_.declare(entity_registry_, sig, system.get_name())) {
+                dispatcher_.trigger<gaming::event::fatal_error>(std::make_error_code(std::errc::invalid_argument));
+            }
+        }
+    }
+
+    void system_manager::produce_render_snapshot_() noexcept {
+        if (auto buffer = entity_registry_.try_ctx<render_snapshot_buffer>(); buffer != nullptr) {
+            buffer->produce(entity_registry_, entity_registry_.ctx<interpolation_system::st_interpolation>().value());
+        }
+    }
+
+    void system_manager::drain_events_() noexcept {
+        if (auto bus = entity_registry_.try_ctx<gaming::event::event_bus>(); bus != nullptr) {
+            bus->drain();
+        }
+    }
+
+    void system_manager::capture_rollback_() noexcept {
+        if (auto rollback = entity_registry_.try_ctx<rollback_buffer>(); rollback != nullptr) {
+            rollback->capture(entity_registry_, logic_tick_);
+        }
+    }
+
+    void system_manager::record_frame_(std::size_t nb_logic_ticks) noexcept {
+        if (auto recorder = entity_registry_.try_ctx<timer::frame_recorder>(); recorder != nullptr) {
+            recorder->record(timestep_.get_last_frame_time(), nb_logic_ticks, timestep_.get_lag());
+        }
+    }
 }
 
 //! Public implementation
 namespace antara::gaming::ecs {
     system_manager::system_manager(entt::registry &reg, bool susbscribe_to_internal_events) noexcept:
             entity_registry_(reg),
-            dispatcher_(reg.ctx<entt::dispatcher>()) {
+            dispatcher_(reg.ctx<entt::dispatcher>()),
+            timestep_(reg.try_ctx<timer::time_step>() != nullptr ? reg.ctx<timer::time_step>()
+                                                                 : reg.set<timer::time_step>()) {
         LOG_SCOPE_FUNCTION(INFO);
         create_system<interpolation_system>();
         reg.set<interpolation_system::st_interpolation>(0.f);
         if (susbscribe_to_internal_events) {
             dispatcher_.sink<event::add_base_system>().connect<&system_manager::receive_add_base_system>(*this);
-            reg.on_construct<transform::position_2d>().connect<&on_position_build>();
+            interpolation_system::connect_positions(reg);
+            graphics::connect_layers(reg);
             assert(not dispatcher_.sink<event::add_base_system>().empty());
         }
     }
@@ -76,19 +135,30 @@ namespace antara::gaming::ecs {
             return 0u;
 
         std::size_t nb_systems_updated = 0u;
+        std::size_t nb_logic_ticks = 0u;
+        update_stats_ = {};
         timestep_.start_frame();
         nb_systems_updated += update_systems(system_type::pre_update);
+        drain_events_();
 
         //LCOV_EXCL_START
         while (timestep_.is_update_required()) {
             nb_systems_updated += update_systems(system_type::logic_update);
+            drain_events_();
+            ++logic_tick_;
+            capture_rollback_();
             timestep_.perform_update();
+            ++nb_logic_ticks;
         }
         //LCOV_EXCL_STOP
 
         auto &interp = entity_registry_.ctx<interpolation_system::st_interpolation>();
         interp = interpolation_system::st_interpolation{timestep_.get_interpolation()};
+        interpolation_system::interpolate(entity_registry_, interp.value());
+        record_frame_(nb_logic_ticks);
+        produce_render_snapshot_();
         nb_systems_updated += update_systems(system_type::post_update);
+        drain_events_();
 
         if (need_to_sweep_systems_) {
             sweep_systems_();
@@ -108,18 +178,74 @@ namespace antara::gaming::ecs {
         }
         //LCOV_EXCL_STOP
 
+        auto &startup_trace = timer::startup_trace::shared();
+        if (startup_trace.is_recording() && startup_trace.mark_first_frame()) {
+            const auto time_to_first_frame = startup_trace.get_time_to_first_frame();
+            DVLOG_F(loguru::Verbosity_INFO, "time to first frame: {} ms",
+                    std::chrono::duration_cast<std::chrono::milliseconds>(time_to_first_frame).count());
+            if (time_to_first_frame > timer::startup_trace::first_frame_budget) {
+                VLOG_F(loguru::Verbosity_WARNING, "first frame over the {} ms budget, see timer::startup_trace",
+                       timer::startup_trace::first_frame_budget.count());
+            }
+        }
+
         return nb_systems_updated;
     }
 
     std::size_t system_manager::update_systems(system_type system_type_to_update) noexcept {
         std::size_t nb_systems_updated = 0ull;
+        const bool is_logic = system_type_to_update == system_type::logic_update;
         for (auto &&current_sys : systems_[system_type_to_update] | ranges::views::filter(&base_system::is_enabled)) {
-            current_sys->update();
+            //! low-rate systems get staggered phases the first time they are scheduled
+            if (is_logic && current_sys->get_tick_divisor() > 1u && not current_sys->has_tick_phase()) {
+                current_sys->set_tick_phase(next_tick_phase_++);
+            }
+            if (is_logic && not current_sys->is_due(logic_tick_)) {
+                update_stats_.nb_off_cadence += 1;
+                continue;
+            }
+            if (not current_sys->try_wake_up()) {
+                update_stats_.nb_sleeping += 1;
+                continue;
+            }
+            const std::size_t nb_substeps = is_logic ? current_sys->get_nb_substeps() : 1u;
+            for (std::size_t substep = 0u; substep < nb_substeps; ++substep) {
+                current_sys->update();
+            }
+            if (current_sys->is_event_driven()) {
+                current_sys->sleep();
+            }
             nb_systems_updated += 1;
         }
+        update_stats_.nb_updated += nb_systems_updated;
         return nb_systems_updated;
     }
 
+    std::size_t system_manager::resimulate_from(std::uint64_t tick) noexcept {
+        auto rollback = entity_registry_.try_ctx<rollback_buffer>();
+        if (rollback == nullptr || tick > logic_tick_ || not rollback->restore(entity_registry_, tick)) {
+            return 0u;
+        }
+        const auto present = logic_tick_;
+        logic_tick_ = tick;
+        while (logic_tick_ < present) {
+            update_systems(system_type::logic_update);
+            drain_events_();
+            ++logic_tick_;
+            capture_rollback_();
+        }
+        DVLOG_F(loguru::Verbosity_INFO, "resimulated {} logic ticks from tick {}", present - tick, tick);
+        return static_cast<std::size_t>(present - tick);
+    }
+
+    std::uint64_t system_manager::get_logic_tick() const noexcept {
+        return logic_tick_;
+    }
+
+    const system_manager::update_stats &system_manager::get_update_stats() const noexcept {
+        return update_stats_;
+    }
+
     void system_manager::receive_add_base_system(const ecs::event::add_base_system &evt) noexcept {
         LOG_SCOPE_FUNCTION(INFO);
         assert(evt.system_ptr != nullptr);
@@ -134,7 +260,8 @@ namespace antara::gaming::ecs {
     void system_manager::start() noexcept {
         LOG_SCOPE_FUNCTION(INFO);
         game_is_running_ = true;
-        antara::gaming::timer::time_step::reset_lag();
+        timestep_.reset_lag();
+        capture_rollback_();
     }
 
     system_manager::~system_manager() noexcept { LOG_SCOPE_FUNCTION(INFO); }
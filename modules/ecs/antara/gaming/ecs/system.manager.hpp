@@ -18,16 +18,17 @@
 
 //! C System Headers
 #include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
 
 //! C++ System Headers
-#include <algorithm> ///< std::iter_swap
+#include <algorithm> ///< std::iter_swap, std::fill
 #include <array> ///< std::array
-#include <functional> ///< std::reference_wrapper
+#include <functional> ///< std::reference_wrapper, std::function
 #include <memory> ///< std::unique_ptr
 #include <queue> ///< std::queue
 #include <system_error> ///< std::error_code
-#include <tuple> ///< std::tuple
-#include <type_traits> ///< std::add_lvalue_reference, std::add_const_t
+#include <tuple> ///< std::tuple, std::apply
+#include <type_traits> ///< std::add_lvalue_reference, std::add_const_t, std::decay_t
 #include <utility> ///< std::forward, std::move
 #include <vector> ///< std::vector
 
@@ -36,15 +37,19 @@
 #include <entt/entity/registry.hpp> ///< entt::registry
 #include <loguru.hpp> ///< LOG_SCOPE_FUNCTION
 #include <range/v3/algorithm/find_if.hpp> ///< ranges::find_if
-#include <range/v3/algorithm/any_of.hpp> ///< ranges::any_of
 #include <tl/expected.hpp> ///< tl::expected
 
 //! SDK Headers
 #include "antara/gaming/ecs/base.system.hpp" ///< ecs::base_system
 #include "antara/gaming/ecs/event.add.base.system.hpp" ///< event::add_base_system
+#include "antara/gaming/ecs/group.declaration.hpp" ///< ecs::group_declarations
+#include "antara/gaming/ecs/rollback.buffer.hpp" ///< ecs::rollback_buffer
 #include "antara/gaming/ecs/system.hpp" ///< ecs::system
 #include "antara/gaming/ecs/system.type.hpp" ///< ecs::system_type
+#include "antara/gaming/event/event.bus.hpp" ///< event::event_bus
 #include "antara/gaming/event/fatal.error.hpp" ///< event::fatal_error
+#include "antara/gaming/timer/frame.recorder.hpp" ///< timer::frame_recorder
+#include "antara/gaming/timer/startup.trace.hpp" ///< timer::startup_trace
 #include "antara/gaming/timer/time.step.hpp" ///< timer::time_step
 
 namespace antara::gaming::ecs {
@@ -53,6 +58,17 @@ namespace antara::gaming::ecs {
      * @brief This class allows the manipulation of systems, the addition, deletion, update of systems, deactivation of a system, etc.
      */
     class system_manager {
+    public:
+        //! Public typedefs
+
+        /// @brief introspection counters of the last update(), reset at each frame
+        struct update_stats {
+            std::size_t nb_updated{0u}; ///< systems updated, a system is counted at each logic tick
+            std::size_t nb_sleeping{0u}; ///< enabled systems skipped because they were sleeping
+            std::size_t nb_off_cadence{0u}; ///< logic systems skipped because their tick divisor was not due
+        };
+
+    private:
         //! Private typedefs
 
         /// @brief sugar name for an chrono steady clock
@@ -70,11 +86,30 @@ namespace antara::gaming::ecs {
         /// @brief sugar name for a queue of system pointer to add.
         using systems_queue = std::queue<system_ptr>;
 
+        /// @brief sugar name for the dense index of the systems, addressed by system_id
+        using systems_index = std::vector<base_system *>;
+
         //! Private member functions
         base_system &add_system_(system_ptr &&system, system_type sys_type) noexcept;
 
         void sweep_systems_() noexcept;
 
+        void index_system_(base_system &system) noexcept;
+
+        void rebuild_systems_index_() noexcept;
+
+        [[nodiscard]] base_system *find_system_(system_id id) const noexcept;
+
+        void declare_groups_(const base_system &system) noexcept;
+
+        void produce_render_snapshot_() noexcept;
+
+        void drain_events_() noexcept;
+
+        void capture_rollback_() noexcept;
+
+        void record_frame_(std::size_t nb_logic_ticks) noexcept;
+
         template<typename TSystem>
         tl::expected<std::reference_wrapper<TSystem>, std::error_code> get_system_() noexcept;
 
@@ -84,11 +119,17 @@ namespace antara::gaming::ecs {
         //! Private data members
         entt::registry &entity_registry_;
         entt::dispatcher &dispatcher_;
-        timer::time_step timestep_;
+        timer::time_step &timestep_; ///< in the registry context, so every registry keeps its own pace
         system_registry systems_{{}};
         systems_queue systems_to_add_;
+        systems_index systems_index_;
+        group_declarations group_declarations_;
         bool need_to_sweep_systems_{false};
         bool game_is_running_{false};
+        std::uint64_t logic_tick_{0ull};
+        std::size_t next_tick_phase_{0u};
+        std::vector<std::function<void()>> deferred_systems_; ///< indexed by system id, creators waiting for enable_system
+        update_stats update_stats_;
     public:
         //! Constructor
 
@@ -167,7 +208,11 @@ namespace antara::gaming::ecs {
          *      .. warning::
          *         If you have not loaded any system into the system_manager the function returns 0. :raw-html:`<br />`
          *         If you decide to mark a system, it's automatically deleted at the end of the current loop tick through this function. :raw-html:`<br />`
-         *         If you decide to add a system through an `ecs::event::add_base_system event`, it's automatically added at the end of the current loop tick through this function.
+         *         If you decide to add a system through an `ecs::event::add_base_system event`, it's automatically added at the end of the current loop tick through this function. :raw-html:`<br />`
+         *         If an `ecs::render_snapshot_buffer` is set in the registry context, a render snapshot is published after the logic ticks of each frame. :raw-html:`<br />`
+         *         If an `event::event_bus` is set in the registry context, its queued events are drained after each phase (pre_update, every logic tick, post_update). :raw-html:`<br />`
+         *         Sleeping systems are skipped until they are woken up, see base_system::sleep and the wake_on_events / wake_on_components declarations. :raw-html:`<br />`
+         *         If an `ecs::rollback_buffer` is set in the registry context, it captures the state after every logic tick.
          * @endverbatim
          *
          * **Example:**
@@ -210,6 +255,20 @@ namespace antara::gaming::ecs {
          */
         std::size_t update_systems(system_type system_type_to_update) noexcept;
 
+        /**
+         * @brief restore the given logic tick from the `ecs::rollback_buffer` of the registry context, then replay the logic ticks up to the present.
+         * @param tick logic tick to restore, between rollback_buffer::oldest_tick() and get_logic_tick()
+         * @return number of logic ticks resimulated, 0 if there is no rollback buffer or if the tick is not in it anymore
+         * @note inputs for the past ticks (eg: late network inputs) have to be fixed before calling it.
+         */
+        std::size_t resimulate_from(std::uint64_t tick) noexcept;
+
+        /// @return number of logic ticks performed since start()
+        [[nodiscard]] std::uint64_t get_logic_tick() const noexcept;
+
+        /// @return how many systems ran or slept during the last update()
+        [[nodiscard]] const update_stats &get_update_stats() const noexcept;
+
         /**
          * @brief This function allows you to get a system through a template parameter.
          * @tparam TSystem represents the system to get.
@@ -470,6 +529,8 @@ namespace antara::gaming::ecs {
          * @endcode
          *
          * @return true if the system has been enabled, false otherwise
+         * @note a system registered with defer_system is constructed here, once the game is running it is only added
+         *       at the end of the current frame, as the systems created with create_system_rt
          */
         template<typename TSystem>
         bool enable_system() noexcept;
@@ -664,6 +725,18 @@ namespace antara::gaming::ecs {
         template<typename TSystem, typename ... TSystemArgs>
         void create_system_rt(TSystemArgs &&... args) noexcept;
 
+        /**
+         * @brief register a system to be constructed by the first enable_system call instead of now.
+         * @note arguments are copied or moved in until the system is constructed, wrap them in std::ref to pass a reference.
+         *       Does nothing if the system already exists.
+         */
+        template<typename TSystem, typename ... TSystemArgs>
+        void defer_system(TSystemArgs &&... args) noexcept;
+
+        /// @return true if the system was deferred and is not constructed yet
+        template<typename TSystem>
+        [[nodiscard]] bool is_system_deferred() const noexcept;
+
         /**
          * @brief This function load a bunch os systems
          * @tparam TSystems represents a list of systems to be loaded
@@ -27,10 +27,11 @@ namespace antara::gaming::ecs {
 
         auto sys_type = SystemToSwap::get_system_type();
         auto &&sys_collection = systems_[sys_type];
-        auto name = SystemToSwap::get_class_name();
-        auto it_system_to_swap = find_if(sys_collection, [&name](auto &&sys) { return sys->get_name() == name; });
-        name = SystemB::get_class_name();
-        auto it_system_b = find_if(sys_collection, [&name](auto &&sys) { return sys->get_name() == name; });
+        auto system_to_swap = find_system_(SystemToSwap::get_system_id());
+        auto it_system_to_swap = find_if(sys_collection,
+                                         [system_to_swap](auto &&sys) { return sys.get() == system_to_swap; });
+        auto system_b = find_system_(SystemB::get_system_id());
+        auto it_system_b = find_if(sys_collection, [system_b](auto &&sys) { return sys.get() == system_b; });
 
         if (it_system_to_swap != systems_[sys_type].end() && it_system_b != systems_[sys_type].end()) {
             if (it_system_to_swap > it_system_b) { std::iter_swap(it_system_to_swap, it_system_b); }
@@ -78,10 +79,41 @@ namespace antara::gaming::ecs {
                                              std::forward<decltype(args_)>(args_)...);
         };
 
+        auto trace_scope = timer::startup_trace::shared().measure("system", TSystem::get_class_name());
         system_ptr sys = creator(std::forward<TSystemArgs>(args)...);
+        trace_scope.close();
         return static_cast<TSystem &>(add_system_(std::move(sys), TSystem::get_system_type()));
     }
 
+    template<typename TSystem, typename... TSystemArgs>
+    void system_manager::defer_system(TSystemArgs &&... args) noexcept {
+        if (has_system<TSystem>()) {
+            return;
+        }
+        const auto id = TSystem::get_system_id();
+        if (deferred_systems_.size() <= id) {
+            deferred_systems_.resize(id + 1u);
+        }
+        deferred_systems_[id] = [this, args_ = std::tuple<std::decay_t<TSystemArgs>...>(
+                std::forward<TSystemArgs>(args)...)]() mutable {
+            std::apply([this](auto &&... sys_args) {
+                if (this->game_is_running_) {
+                    //! update_systems may be iterating systems_, the system joins them at the end of the frame
+                    this->systems_to_add_.push(std::make_unique<TSystem>(this->entity_registry_,
+                                                                         std::forward<decltype(sys_args)>(sys_args)...));
+                } else {
+                    this->create_system<TSystem>(std::forward<decltype(sys_args)>(sys_args)...);
+                }
+            }, std::move(args_));
+        };
+    }
+
+    template<typename TSystem>
+    bool system_manager::is_system_deferred() const noexcept {
+        const auto id = TSystem::get_system_id();
+        return id < deferred_systems_.size() && static_cast<bool>(deferred_systems_[id]);
+    }
+
     template<typename TSystem, typename... TSystemArgs>
     void system_manager::create_system_rt(TSystemArgs &&... args) noexcept {
         LOG_SCOPE_FUNCTION(INFO);
@@ -104,10 +136,7 @@ namespace antara::gaming::ecs {
 
     template<typename TSystem>
     bool system_manager::has_system() const noexcept {
-        constexpr const auto sys_type = TSystem::get_system_type();
-        return ranges::any_of(systems_[sys_type], [](auto &&ptr) {
-            return ptr->get_name() == TSystem::get_class_name();
-        });
+        return find_system_(TSystem::get_system_id()) != nullptr;
     }
 
     template<typename... TSystems>
@@ -133,6 +162,15 @@ namespace antara::gaming::ecs {
 
     template<typename TSystem>
     bool system_manager::enable_system() noexcept {
+        if (is_system_deferred<TSystem>()) {
+            auto create = std::move(deferred_systems_[TSystem::get_system_id()]);
+            deferred_systems_[TSystem::get_system_id()] = nullptr;
+            create();
+            if (game_is_running_) {
+                //! queued in systems_to_add_, systems are enabled once constructed
+                return true;
+            }
+        }
         if (has_system<TSystem>()) {
             get_system<TSystem>().enable();
             return true;
@@ -161,35 +199,16 @@ namespace antara::gaming::ecs {
 
     template<typename TSystem>
     tl::expected<std::reference_wrapper<TSystem>, std::error_code> system_manager::get_system_() noexcept {
-        if (not nb_systems(TSystem::get_system_type())) {
-            return tl::make_unexpected(std::make_error_code(std::errc::result_out_of_range)); //LCOV_EXCL_LINE
-        }
-
-        constexpr const auto sys_type = TSystem::get_system_type();
-        auto it = ranges::find_if(systems_[sys_type], [](auto &&ptr) {
-            return ptr->get_name() == TSystem::get_class_name();
-        });
-
-        if (it != systems_[sys_type].end()) {
-            auto &system = static_cast<TSystem &>(*(*it));
-            return std::reference_wrapper<TSystem>(system);
+        if (auto system = find_system_(TSystem::get_system_id()); system != nullptr) {
+            return std::reference_wrapper<TSystem>(static_cast<TSystem &>(*system));
         }
         return tl::make_unexpected(std::make_error_code(std::errc::result_out_of_range)); //LCOV_EXCL_LINE
     }
 
     template<typename TSystem>
     tl::expected<std::reference_wrapper<const TSystem>, std::error_code> system_manager::get_system_() const noexcept {
-        if (not nb_systems(TSystem::get_system_type())) {
-            return tl::make_unexpected(std::make_error_code(std::errc::result_out_of_range)); //LCOV_EXCL_LINE
-        }
-
-        constexpr const auto sys_type = TSystem::get_system_type();
-        auto it = ranges::find_if(systems_[sys_type], [](auto &&ptr) {
-            return ptr->get_name() == TSystem::get_class_name();
-        });
-        if (it != systems_[sys_type].end()) {
-            const auto &system = static_cast<const TSystem &>(*(*it));
-            return std::reference_wrapper<const TSystem>(system);
+        if (auto system = find_system_(TSystem::get_system_id()); system != nullptr) {
+            return std::reference_wrapper<const TSystem>(static_cast<const TSystem &>(*system));
         }
         return tl::make_unexpected(std::make_error_code(std::errc::result_out_of_range)); //LCOV_EXCL_LINE
     }
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! SDK Headers
+#include "antara/gaming/ecs/time.slicer.hpp"
+
+namespace antara::gaming::ecs {
+    time_slicer::time_slicer(std::size_t entity_budget, std::chrono::nanoseconds time_budget) noexcept :
+            entity_budget_(entity_budget), time_budget_(time_budget) {
+    }
+
+    void time_slicer::begin_slice_(const entt::entity *pool_data, std::size_t pool_size) {
+        if (not sweeping_) {
+            sweeping_ = true;
+            //! the pool can be reordered or shrink between two slices, the sweep walks its own copy
+            entities_.assign(pool_data, pool_data + pool_size);
+            cursor_ = pool_size;
+            slices_in_sweep_ = 0u;
+        }
+        ++slices_in_sweep_;
+    }
+
+    bool time_slicer::budget_exhausted_(std::size_t nb_visited, clock::time_point start) const noexcept {
+        if (entity_budget_ > 0u && nb_visited >= entity_budget_) {
+            return true;
+        }
+        //! the clock is only read every few entities, and a slice always makes progress
+        return time_budget_ > std::chrono::nanoseconds::zero() && nb_visited > 0u &&
+               nb_visited % time_check_every_ == 0u && clock::now() - start >= time_budget_;
+    }
+
+    void time_slicer::end_slice_() noexcept {
+        if (cursor_ == 0u) {
+            sweeping_ = false;
+            last_sweep_ticks_ = slices_in_sweep_;
+            ++nb_sweeps_;
+        }
+    }
+
+    void time_slicer::set_entity_budget(std::size_t entity_budget) noexcept {
+        entity_budget_ = entity_budget;
+    }
+
+    void time_slicer::set_time_budget(std::chrono::nanoseconds time_budget) noexcept {
+        time_budget_ = time_budget;
+    }
+
+    void time_slicer::reset() noexcept {
+        sweeping_ = false;
+        entities_.clear();
+        cursor_ = 0u;
+        slices_in_sweep_ = 0u;
+    }
+
+    std::size_t time_slicer::get_last_sweep_ticks() const noexcept {
+        return last_sweep_ticks_;
+    }
+
+    std::uint64_t time_slicer::get_nb_sweeps() const noexcept {
+        return nb_sweeps_;
+    }
+
+    std::size_t time_slicer::get_cursor() const noexcept {
+        return cursor_;
+    }
+
+    bool time_slicer::is_sweeping() const noexcept {
+        return sweeping_;
+    }
+}
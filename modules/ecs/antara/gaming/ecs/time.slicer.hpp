@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <chrono> ///< std::chrono::steady_clock, std::chrono::nanoseconds
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry, entt::entity
+
+namespace antara::gaming::ecs {
+    /**
+     * @class time_slicer
+     * @brief Spread the processing of a view over several ticks, within an entity or time budget per tick.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         A sweep starts by copying the entities of the pool of the first component, the slicer then walks this copy backward
+     *         and resumes where it stopped at the next slice, so destroying or sorting entities in between can't shift the cursor.
+     *         Entities created during a sweep are processed by the next sweep, entities destroyed (or which lost a component)
+     *         during a sweep are skipped, every other entity is processed exactly once per sweep.
+     *         Every visited entity counts toward the budget, including the skipped ones.
+     *         A slice never starts a new sweep, so an entity is processed at most once per slice.
+     *
+     *      .. code-block:: cpp
+     *
+     *          class visibility_system final : public ecs::logic_update_system<visibility_system> {
+     *          public:
+     *              void update() noexcept final {
+     *                  slicer_.process<transform::position_2d, ai::sight>(entity_registry_, [](auto entity, auto &pos, auto &sight) {
+     *                      //! expensive work
+     *                  });
+     *              }
+     *          private:
+     *              ecs::time_slicer slicer_{500u};
+     *          };
+     * @endverbatim
+     */
+    class time_slicer {
+    public:
+        //! Constructors
+
+        /**
+         * @param entity_budget maximum number of entities processed per slice, 0 for no limit
+         * @param time_budget maximum duration of a slice, 0 for no limit
+         */
+        explicit time_slicer(std::size_t entity_budget = 0u,
+                             std::chrono::nanoseconds time_budget = std::chrono::nanoseconds::zero()) noexcept;
+
+        //! Public member functions
+
+        /**
+         * @brief process the next slice of the entities having every component, call functor(entity, components&...) for each.
+         * @tparam TComponent component whose pool is walked, prefer the rarest one
+         * @return number of entities processed during this slice
+         */
+        template<typename TComponent, typename ... TOthers, typename TFunctor>
+        std::size_t process(entt::registry &registry, TFunctor &&functor);
+
+        void set_entity_budget(std::size_t entity_budget) noexcept;
+
+        void set_time_budget(std::chrono::nanoseconds time_budget) noexcept;
+
+        /// @brief restart from the end of the pool at the next slice.
+        void reset() noexcept;
+
+        //! Public getters
+
+        /// @return number of slices (ticks) the last complete sweep took, 0 if no sweep completed yet
+        [[nodiscard]] std::size_t get_last_sweep_ticks() const noexcept;
+
+        [[nodiscard]] std::uint64_t get_nb_sweeps() const noexcept;
+
+        /// @return number of entities left to visit in the current sweep
+        [[nodiscard]] std::size_t get_cursor() const noexcept;
+
+        [[nodiscard]] bool is_sweeping() const noexcept;
+
+    private:
+        //! Private typedefs
+        using clock = std::chrono::steady_clock;
+
+        //! Private constants
+        static constexpr std::size_t time_check_every_{16u};
+
+        //! Private fields
+        std::size_t entity_budget_;
+        std::chrono::nanoseconds time_budget_;
+        std::vector<entt::entity> entities_;
+        std::size_t cursor_{0u};
+        bool sweeping_{false};
+        std::size_t slices_in_sweep_{0u};
+        std::size_t last_sweep_ticks_{0u};
+        std::uint64_t nb_sweeps_{0u};
+
+        //! Private member functions
+        void begin_slice_(const entt::entity *pool_data, std::size_t pool_size);
+
+        [[nodiscard]] bool budget_exhausted_(std::size_t nb_visited, clock::time_point start) const noexcept;
+
+        void end_slice_() noexcept;
+    };
+}
+
+//! Implementation
+#include "antara/gaming/ecs/time.slicer.ipp"
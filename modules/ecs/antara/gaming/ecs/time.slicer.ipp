@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C++ System Headers
+#include <utility> ///< std::forward
+
+namespace antara::gaming::ecs {
+    template<typename TComponent, typename ... TOthers, typename TFunctor>
+    std::size_t time_slicer::process(entt::registry &registry, TFunctor &&functor) {
+        auto view = registry.view<TComponent>();
+        begin_slice_(view.data(), view.size());
+        const auto start = clock::now();
+        std::size_t nb_visited = 0u;
+        std::size_t nb_processed = 0u;
+        while (cursor_ > 0u && not budget_exhausted_(nb_visited, start)) {
+            --cursor_;
+            ++nb_visited;
+            const auto entity = entities_[cursor_];
+            if (not registry.valid(entity) || not registry.has<TComponent, TOthers...>(entity)) {
+                continue;
+            }
+            functor(entity, registry.get<TComponent>(entity), registry.get<TOthers>(entity)...);
+            ++nb_processed;
+        }
+        end_slice_();
+        return nb_processed;
+    }
+}
@@ -0,0 +1,38 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! Dependencies Headers
+#include <meta/detection/detection.hpp> ///< doom::meta::is_detected_v
+#include <meta/sequence/list.hpp> ///< doom::meta::list
+
+namespace antara::gaming::ecs {
+    //! Meta-functions
+
+    /// @brief events which wake the system up, declared as `using wake_on_events = doom::meta::list<TEvents...>;`
+    template<typename TSystem>
+    using wake_on_events_t = typename TSystem::wake_on_events;
+
+    /// @brief components whose construction or replacement wake the system up, declared as `using wake_on_components = doom::meta::list<TComponents...>;`
+    template<typename TSystem>
+    using wake_on_components_t = typename TSystem::wake_on_components;
+
+    /// @brief true if TSystem declares wake conditions, such systems start asleep and go back to sleep after each update.
+    template<typename TSystem>
+    inline constexpr bool is_event_driven_v = doom::meta::is_detected_v<wake_on_events_t, TSystem> ||
+                                              doom::meta::is_detected_v<wake_on_components_t, TSystem>;
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <algorithm> ///< std::max
+
+//! SDK Headers
+#include "antara/gaming/ecs/worker.pool.hpp"
+
+namespace {
+    thread_local bool inside_worker_pool = false;
+}
+
+//! Private implementation
+namespace antara::gaming::ecs {
+    void worker_pool::worker_loop_() noexcept {
+        inside_worker_pool = true;
+        std::uint64_t seen_generation = 0u;
+        for (;;) {
+            const task_t *task = nullptr;
+            std::size_t nb_chunks = 0u;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this, seen_generation]() { return stop_ || generation_ != seen_generation; });
+                if (stop_) {
+                    return;
+                }
+                seen_generation = generation_;
+                task = task_;
+                nb_chunks = nb_chunks_;
+            }
+            drain_(*task, nb_chunks);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--nb_busy_workers_ == 0u) {
+                    done_cv_.notify_one();
+                }
+            }
+        }
+    }
+
+    void worker_pool::drain_(const task_t &task, std::size_t nb_chunks) noexcept {
+        for (auto chunk = next_chunk_.fetch_add(1u, std::memory_order_relaxed); chunk < nb_chunks;
+             chunk = next_chunk_.fetch_add(1u, std::memory_order_relaxed)) {
+            task(chunk);
+        }
+    }
+}
+
+//! Public implementation
+namespace antara::gaming::ecs {
+    worker_pool::worker_pool(std::size_t nb_workers) noexcept {
+        workers_.reserve(nb_workers);
+        for (std::size_t i = 0u; i < nb_workers; ++i) {
+            workers_.emplace_back(&worker_pool::worker_loop_, this);
+        }
+    }
+
+    worker_pool::worker_pool() noexcept : worker_pool(std::max(std::thread::hardware_concurrency(), 1u) - 1u) {
+    }
+
+    worker_pool::~worker_pool() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto &&worker : workers_) {
+            worker.join();
+        }
+    }
+
+    worker_pool &worker_pool::shared() noexcept {
+        static worker_pool pool;
+        return pool;
+    }
+
+    std::size_t worker_pool::concurrency() const noexcept {
+        return workers_.size() + 1u;
+    }
+
+    void worker_pool::run(std::size_t nb_chunks, const task_t &task) noexcept {
+        if (workers_.empty() || nb_chunks < 2u || inside_worker_pool) {
+            for (std::size_t chunk = 0u; chunk < nb_chunks; ++chunk) {
+                task(chunk);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            nb_chunks_ = nb_chunks;
+            next_chunk_.store(0u, std::memory_order_relaxed);
+            nb_busy_workers_ = workers_.size();
+            ++generation_;
+        }
+        work_cv_.notify_all();
+        inside_worker_pool = true;
+        drain_(task, nb_chunks);
+        inside_worker_pool = false;
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return nb_busy_workers_ == 0u; });
+        task_ = nullptr;
+    }
+}
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <atomic> ///< std::atomic
+#include <condition_variable> ///< std::condition_variable
+#include <functional> ///< std::function
+#include <mutex> ///< std::mutex
+#include <thread> ///< std::thread
+#include <vector> ///< std::vector
+
+namespace antara::gaming::ecs {
+    /**
+     * @class worker_pool
+     * @brief Fork-join pool of threads used by parallel_for_each and parallel_reduce.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The calling thread takes part in the work, run() returns once every chunk is processed.
+     *         A run() issued from inside a task is executed serially by the calling worker.
+     * @endverbatim
+     */
+    class worker_pool {
+        //! Private typedefs
+        using task_t = std::function<void(std::size_t)>;
+
+        //! Private member functions
+        void worker_loop_() noexcept;
+
+        void drain_(const task_t &task, std::size_t nb_chunks) noexcept;
+
+        //! Private data members
+        std::vector<std::thread> workers_;
+        std::mutex run_mutex_;
+        std::mutex mutex_;
+        std::condition_variable work_cv_;
+        std::condition_variable done_cv_;
+        const task_t *task_{nullptr};
+        std::size_t nb_chunks_{0u};
+        std::atomic<std::size_t> next_chunk_{0u};
+        std::size_t nb_busy_workers_{0u};
+        std::uint64_t generation_{0u};
+        bool stop_{false};
+    public:
+        //! Constructors
+
+        /// @param nb_workers number of threads spawned, in addition to the calling thread
+        explicit worker_pool(std::size_t nb_workers) noexcept;
+
+        /// @brief spawns one worker less than the hardware concurrency
+        worker_pool() noexcept;
+
+        worker_pool(const worker_pool &) = delete;
+
+        worker_pool &operator=(const worker_pool &) = delete;
+
+        //! Destructor
+        ~worker_pool() noexcept;
+
+        //! Public static functions
+
+        /// @return pool shared by the whole process, created on first use
+        static worker_pool &shared() noexcept;
+
+        //! Public member functions
+
+        /// @return number of threads working on a run, calling thread included
+        [[nodiscard]] std::size_t concurrency() const noexcept;
+
+        /**
+         * @brief call task(chunk_index) for every chunk_index in [0, nb_chunks) across the pool.
+         * @note chunks are handed out dynamically, the order of execution is unspecified.
+         */
+        void run(std::size_t nb_chunks, const task_t &task) noexcept;
+    };
+}
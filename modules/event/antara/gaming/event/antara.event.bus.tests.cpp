@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "antara/gaming/event/event.bus.hpp"
+#include "antara/gaming/event/quit.game.hpp"
+
+namespace antara::gaming::event::tests
+{
+    struct quit_game_listener
+    {
+        std::size_t nb_calls{0u};
+        int sum{0};
+
+        void on_quit_game(event_span<quit_game> events) noexcept
+        {
+            nb_calls += 1;
+            for (auto &&evt : events) {
+                sum += evt.return_value_;
+            }
+        }
+    };
+
+    struct late_event
+    {
+        int value{0};
+    };
+
+    TEST_SUITE("event bus")
+    {
+        TEST_CASE("ring buffer")
+        {
+            event_ring<int> ring{3u};
+            CHECK_EQ(ring.capacity(), 4u);
+            for (int i = 0; i < 4; ++i) {
+                CHECK(ring.try_emplace(i));
+            }
+            CHECK_FALSE(ring.try_emplace(4));
+            std::vector<int> out;
+            CHECK_EQ(ring.consume([&out](int &&value) { out.push_back(value); }), 4u);
+            CHECK_EQ(out, std::vector<int>{0, 1, 2, 3});
+            CHECK(ring.try_emplace(5));
+        }
+
+        TEST_CASE("events are delivered in batch")
+        {
+            event_bus bus;
+            quit_game_listener listener;
+            CHECK_FALSE(bus.enqueue<quit_game>(1));
+            bus.connect<quit_game, &quit_game_listener::on_quit_game>(listener);
+            CHECK(bus.enqueue<quit_game>(1));
+            CHECK(bus.enqueue<quit_game>(2));
+            CHECK_EQ(listener.nb_calls, 0u);
+            CHECK_EQ(bus.drain(), 2u);
+            CHECK_EQ(listener.nb_calls, 1u);
+            CHECK_EQ(listener.sum, 3);
+            CHECK_EQ(bus.drain(), 0u);
+            CHECK_EQ(listener.nb_calls, 1u);
+        }
+
+        TEST_CASE("listeners can create queues while the bus is drained")
+        {
+            event_bus bus;
+            int late_sum = 0;
+            bus.connect<quit_game>([&bus, &late_sum](event_span<quit_game>) {
+                bus.connect<late_event>([&late_sum](event_span<late_event> events) {
+                    for (auto &&evt : events) {
+                        late_sum += evt.value;
+                    }
+                });
+                bus.enqueue<late_event>(late_event{2});
+            });
+            CHECK(bus.enqueue<quit_game>(1));
+            CHECK_EQ(bus.drain(), 1u);
+            CHECK_EQ(late_sum, 0);
+            CHECK_EQ(bus.drain(), 1u);
+            CHECK_EQ(late_sum, 2);
+        }
+
+        TEST_CASE("overflow keeps every event")
+        {
+            event_bus bus;
+            quit_game_listener listener;
+            bus.queue<quit_game>(4u);
+            bus.connect<quit_game, &quit_game_listener::on_quit_game>(listener);
+            for (int i = 0; i < 10; ++i) {
+                bus.enqueue<quit_game>(1);
+            }
+            CHECK_EQ(bus.drain(), 10u);
+            CHECK_EQ(listener.sum, 10);
+        }
+
+        TEST_CASE("multi producer enqueue")
+        {
+            event_bus bus;
+            quit_game_listener listener;
+            bus.queue<quit_game>(256u);
+            bus.connect<quit_game, &quit_game_listener::on_quit_game>(listener);
+            std::vector<std::thread> producers;
+            for (int producer = 0; producer < 4; ++producer) {
+                producers.emplace_back([&bus]() {
+                    for (int i = 0; i < 1000; ++i) {
+                        bus.enqueue<quit_game>(1);
+                    }
+                });
+            }
+            std::size_t nb_events = 0u;
+            while (nb_events < 4000u) {
+                nb_events += bus.drain();
+            }
+            for (auto &&producer : producers) {
+                producer.join();
+            }
+            CHECK_EQ(nb_events, 4000u);
+            CHECK_EQ(listener.sum, 4000);
+        }
+    }
+}
@@ -0,0 +1,32 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! SDK Headers
+#include "antara/gaming/event/event.bus.hpp"
+
+namespace antara::gaming::event {
+    std::size_t event_bus::drain() noexcept {
+        std::size_t nb_events = 0u;
+        //! a listener may create a queue and grow queues_, new queues are drained by the next call
+        const auto nb_queues = queues_.size();
+        for (std::size_t idx = 0u; idx < nb_queues; ++idx) {
+            if (auto current_queue = queues_[idx].get(); current_queue != nullptr) {
+                nb_events += current_queue->drain();
+            }
+        }
+        return nb_events;
+    }
+}
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+
+//! C++ System Headers
+#include <atomic> ///< std::atomic
+#include <memory> ///< std::unique_ptr, std::make_unique
+#include <utility> ///< std::forward
+#include <vector> ///< std::vector
+
+//! SDK Headers
+#include "antara/gaming/event/event.queue.hpp" ///< event::event_queue, event::event_span
+
+namespace antara::gaming::event {
+    namespace details {
+        inline std::size_t next_event_id() noexcept {
+            static std::atomic<std::size_t> counter{0u};
+            return counter++;
+        }
+
+        template<typename TEvent>
+        std::size_t event_id_of() noexcept {
+            static const std::size_t id = next_event_id();
+            return id;
+        }
+    }
+
+    /**
+     * @class event_bus
+     * @brief Queued counterpart of entt::dispatcher: events are enqueued from any thread and delivered in batch by drain().
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The system_manager drains the bus set in the registry context after each phase (pre_update, every logic
+     *         tick, post_update). Queues and listeners are created from the main thread, before the producers start;
+     *         enqueue() is then safe from any thread. The existing event types can be used as is.
+     * @endverbatim
+     *
+     * **Example:**
+     * @code{.cpp}
+     *          struct collision_listener {
+     *              void on_collisions(event::event_span<collision> collisions) noexcept {}
+     *          };
+     *
+     *          auto &bus = registry.set<event::event_bus>();
+     *          bus.connect<collision, &collision_listener::on_collisions>(listener);
+     *          // from a worker thread
+     *          bus.enqueue<collision>(entity_a, entity_b);
+     * @endcode
+     */
+    class event_bus {
+        //! Private fields
+        std::vector<std::unique_ptr<details::base_event_queue>> queues_;
+    public:
+        //! Public static fields
+        static constexpr std::size_t default_capacity = 1024u;
+
+        //! Public member functions
+
+        /**
+         * @brief retrieve the queue of TEvent, created with the given capacity on first call (main thread only).
+         */
+        template<typename TEvent>
+        event_queue<TEvent> &queue(std::size_t capacity = default_capacity) noexcept {
+            const auto id = details::event_id_of<TEvent>();
+            if (id >= queues_.size()) {
+                queues_.resize(id + 1u);
+            }
+            if (queues_[id] == nullptr) {
+                queues_[id] = std::make_unique<event_queue<TEvent>>(capacity);
+            }
+            return static_cast<event_queue<TEvent> &>(*queues_[id]);
+        }
+
+        /**
+         * @brief enqueue an event, thread-safe.
+         * @return false if no queue exists for TEvent (nobody listens to it), the event is then dropped.
+         */
+        template<typename TEvent, typename ... TArgs>
+        bool enqueue(TArgs &&... args) noexcept {
+            const auto id = details::event_id_of<TEvent>();
+            if (id >= queues_.size() || queues_[id] == nullptr) {
+                return false;
+            }
+            static_cast<event_queue<TEvent> &>(*queues_[id]).enqueue(std::forward<TArgs>(args)...);
+            return true;
+        }
+
+        /// @brief listen to TEvent, the listener receives every pending event of a drain in one call.
+        template<typename TEvent, typename TListener>
+        void connect(TListener &&listener) noexcept {
+            queue<TEvent>().connect(std::forward<TListener>(listener));
+        }
+
+        /// @overload connect
+        template<typename TEvent, auto Candidate, typename TReceiver>
+        void connect(TReceiver &instance) noexcept {
+            queue<TEvent>().connect([&instance](event_span<TEvent> events) { (instance.*Candidate)(events); });
+        }
+
+        /**
+         * @brief deliver the pending events of every queue to their listeners, consumer side only.
+         * @note listeners may create new queues, those are drained by the next call.
+         * @return number of events delivered
+         */
+        std::size_t drain() noexcept;
+    };
+}
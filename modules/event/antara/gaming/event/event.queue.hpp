@@ -0,0 +1,225 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::intptr_t
+
+//! C++ System Headers
+#include <atomic> ///< std::atomic
+#include <functional> ///< std::function
+#include <memory> ///< std::unique_ptr
+#include <mutex> ///< std::mutex, std::lock_guard
+#include <new> ///< placement new, std::launder
+#include <type_traits> ///< std::aligned_storage_t
+#include <utility> ///< std::forward, std::move
+#include <vector> ///< std::vector
+
+namespace antara::gaming::event {
+    /**
+     * @struct event_span
+     * @brief Contiguous view over a batch of events of the same type, as received by the queued listeners.
+     */
+    template<typename TEvent>
+    struct event_span {
+        const TEvent *data{nullptr};
+        std::size_t size{0u};
+
+        [[nodiscard]] const TEvent *begin() const noexcept { return data; }
+
+        [[nodiscard]] const TEvent *end() const noexcept { return data + size; }
+
+        [[nodiscard]] bool empty() const noexcept { return size == 0u; }
+
+        const TEvent &operator[](std::size_t idx) const noexcept { return data[idx]; }
+    };
+
+    /**
+     * @class event_ring
+     * @brief Bounded ring buffer of events, lock-free for any number of producers and a single consumer.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Every cell carries a sequence number: producers claim a cell with a compare and swap on the enqueue
+     *         position, construct the event in place and publish it by bumping the sequence of the cell.
+     * @endverbatim
+     */
+    template<typename TEvent>
+    class event_ring {
+        //! Private typedefs
+        struct cell {
+            std::atomic<std::size_t> sequence;
+            std::aligned_storage_t<sizeof(TEvent), alignof(TEvent)> storage;
+        };
+
+        //! Private fields
+        std::unique_ptr<cell[]> cells_;
+        std::size_t mask_;
+        alignas(64) std::atomic<std::size_t> enqueue_pos_{0u};
+        alignas(64) std::size_t dequeue_pos_{0u};
+
+        static std::size_t round_capacity_(std::size_t capacity) noexcept {
+            std::size_t rounded = 2u;
+            while (rounded < capacity) {
+                rounded <<= 1u;
+            }
+            return rounded;
+        }
+
+    public:
+        //! Constructor
+        explicit event_ring(std::size_t capacity) noexcept :
+                cells_(std::make_unique<cell[]>(round_capacity_(capacity))),
+                mask_(round_capacity_(capacity) - 1u) {
+            for (std::size_t idx = 0u; idx <= mask_; ++idx) {
+                cells_[idx].sequence.store(idx, std::memory_order_relaxed);
+            }
+        }
+
+        event_ring(const event_ring &) = delete;
+
+        event_ring &operator=(const event_ring &) = delete;
+
+        //! Destructor
+        ~event_ring() noexcept {
+            consume([](TEvent &&) {});
+        }
+
+        //! Public member functions
+        [[nodiscard]] std::size_t capacity() const noexcept { return mask_ + 1u; }
+
+        /**
+         * @brief construct an event in the ring, can be called concurrently from any thread.
+         * @return false if the ring is full
+         */
+        template<typename ... TArgs>
+        bool try_emplace(TArgs &&... args) noexcept {
+            auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+            cell *target = nullptr;
+            for (;;) {
+                target = &cells_[pos & mask_];
+                const auto seq = target->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (diff == 0) {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+            new(&target->storage) TEvent{std::forward<TArgs>(args)...};
+            target->sequence.store(pos + 1u, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief move every published event out of the ring into functor, consumer side only.
+         * @return number of events consumed
+         */
+        template<typename TFunctor>
+        std::size_t consume(TFunctor &&functor) noexcept {
+            std::size_t nb_events = 0u;
+            for (;;) {
+                auto &current = cells_[dequeue_pos_ & mask_];
+                if (current.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1u) {
+                    return nb_events;
+                }
+                auto *evt = std::launder(reinterpret_cast<TEvent *>(&current.storage));
+                functor(std::move(*evt));
+                evt->~TEvent();
+                current.sequence.store(dequeue_pos_ + mask_ + 1u, std::memory_order_release);
+                ++dequeue_pos_;
+                ++nb_events;
+            }
+        }
+    };
+
+    namespace details {
+        //! Type erased queue, drained by the event_bus
+        struct base_event_queue {
+            virtual ~base_event_queue() noexcept = default;
+
+            virtual std::size_t drain() noexcept = 0;
+        };
+    }
+
+    /**
+     * @class event_queue
+     * @brief Queue of one event type: lock-free ring, overflow storage and listeners receiving the events in batch.
+     */
+    template<typename TEvent>
+    class event_queue final : public details::base_event_queue {
+    public:
+        //! Public typedefs
+        using listener = std::function<void(event_span<TEvent>)>;
+
+        //! Constructor
+        explicit event_queue(std::size_t capacity) noexcept : ring_(capacity) {}
+
+        //! Public member functions
+
+        /// @brief thread-safe, lock-free unless the ring is full (the event then goes to a locked overflow storage).
+        template<typename ... TArgs>
+        void enqueue(TArgs &&... args) noexcept {
+            if (ring_.try_emplace(std::forward<TArgs>(args)...)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(overflow_mutex_);
+            overflow_.push_back(TEvent{std::forward<TArgs>(args)...});
+        }
+
+        /// @brief not thread-safe, connect the listeners before the producers start.
+        void connect(listener &&func) noexcept {
+            listeners_.emplace_back(std::move(func));
+        }
+
+        /// @brief deliver every pending event to the listeners, in one contiguous batch.
+        std::size_t drain() noexcept final {
+            batch_.clear();
+            ring_.consume([this](TEvent &&evt) { batch_.push_back(std::move(evt)); });
+            {
+                std::lock_guard<std::mutex> lock(overflow_mutex_);
+                for (auto &&evt : overflow_) {
+                    batch_.push_back(std::move(evt));
+                }
+                overflow_.clear();
+            }
+            if (batch_.empty()) {
+                return 0u;
+            }
+            const event_span<TEvent> events{batch_.data(), batch_.size()};
+            for (auto &&func : listeners_) {
+                func(events);
+            }
+            return events.size;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept { return ring_.capacity(); }
+
+    private:
+        //! Private fields
+        event_ring<TEvent> ring_;
+        std::mutex overflow_mutex_;
+        std::vector<TEvent> overflow_;
+        std::vector<TEvent> batch_;
+        std::vector<listener> listeners_;
+    };
+}
@@ -25,9 +25,11 @@
 #include "antara/gaming/graphics/component.canvas.hpp" ///< graphics::canvas
 #include "antara/gaming/graphics/component.text.hpp" ///< graphics::text
 #include "antara/gaming/graphics/component.sprite.hpp" ///< graphics::sprite, graphics::rect
+#include "antara/gaming/graphics/component.render.stats.hpp" ///< graphics::render_stats
 
 namespace antara::gaming::graphics {
-    using components_list = doom::meta::list<layer_0,
+    using components_list = doom::meta::list<draw_order,
+            layer_0,
             layer_1,
             layer_2,
             layer_3,
@@ -45,5 +47,6 @@ namespace antara::gaming::graphics {
             rectangle,
             canvas_2d,
             rect,
-            sprite>;
+            sprite,
+            render_stats>;
 }
@@ -0,0 +1,112 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include "antara/gaming/graphics/component.layer.hpp"
+#include "antara/gaming/graphics/render.queue.hpp"
+
+namespace antara::gaming::graphics::tests
+{
+    TEST_CASE ("render queue keys")
+    {
+        CHECK_LT(render_queue::make_key(0u, 0.f, 0u, 0u), render_queue::make_key(1u, 0.f, 0u, 0u));
+        CHECK_LT(render_queue::make_key(1u, 500.f, 0u, 0u), render_queue::make_key(2u, -500.f, 0u, 0u));
+        CHECK_LT(render_queue::make_key(1u, -2.f, 0u, 0u), render_queue::make_key(1u, 1.f, 0u, 0u));
+        CHECK_LT(render_queue::make_key(1u, 1.f, 3u, 0u), render_queue::make_key(1u, 1.f, 4u, 0u));
+        CHECK_EQ(render_queue::layer_of(render_queue::make_key(4242u, 1.f, 3u, 5u)), 4242u);
+        CHECK_EQ(render_queue::type_of(render_queue::make_key(4242u, 1.f, 3u, 5u)), 5u);
+    }
+
+    TEST_CASE ("render queue sort")
+    {
+        render_queue queue;
+        for (std::uint32_t layer : {5u, 3u, 1000u, 0u, 3u, 42u, 7u, 1u, 9u, 2u, 8u, 6u, 4u, 11u, 10u, 12u, 13u}) {
+            queue.push(render_queue::make_key(layer, 0.f, 0u, 0u));
+        }
+        queue.sort();
+        auto &items = queue.items();
+        REQUIRE_EQ(items.size(), 17u);
+        for (std::size_t i = 1; i < items.size(); ++i) {
+            CHECK_LE(items[i - 1].key, items[i].key);
+        }
+        CHECK_EQ(render_queue::layer_of(items.back().key), 1000u);
+        //! equal keys keep the push order
+        CHECK_EQ(items[3].index, 1u);
+        CHECK_EQ(items[4].index, 4u);
+        CHECK_EQ(queue.nb_radix_sorts(), 0u);
+
+        //! same frame again: the previous order is already sorted
+        queue.clear();
+        for (std::uint32_t layer : {5u, 3u, 1000u, 0u, 3u, 42u, 7u, 1u, 9u, 2u, 8u, 6u, 4u, 11u, 10u, 12u, 13u}) {
+            queue.push(render_queue::make_key(layer, 0.f, 0u, 0u));
+        }
+        queue.sort();
+        CHECK_EQ(queue.nb_radix_sorts(), 0u);
+        CHECK_EQ(render_queue::layer_of(queue.items().front().key), 0u);
+
+        //! reversed frame: radix sort
+        queue.clear();
+        for (std::uint32_t layer = 200u; layer > 0u; --layer) {
+            queue.push(render_queue::make_key(layer, static_cast<float>(layer) * -0.5f, layer % 7u, layer % 3u));
+        }
+        queue.sort();
+        CHECK_EQ(queue.nb_radix_sorts(), 1u);
+        for (std::size_t i = 1; i < queue.items().size(); ++i) {
+            CHECK_LT(queue.items()[i - 1].key, queue.items()[i].key);
+        }
+        CHECK_EQ(queue.items().front().index, 199u);
+
+        //! few descents but long moves: the insertion sort gives up
+        queue.clear();
+        for (std::uint32_t layer = 1u; layer <= 200u; ++layer) {
+            queue.push(render_queue::make_key(layer, 0.f, 0u, 0u));
+        }
+        queue.sort();
+        CHECK_EQ(queue.nb_radix_sorts(), 2u);
+        queue.clear();
+        for (std::uint32_t layer = 1u; layer <= 200u; ++layer) {
+            queue.push(render_queue::make_key(layer % 10u == 0u ? 0u : layer, 0.f, 0u, 0u));
+        }
+        queue.sort();
+        CHECK_EQ(queue.nb_radix_sorts(), 3u);
+        for (std::size_t i = 1; i < queue.items().size(); ++i) {
+            CHECK_LE(queue.items()[i - 1].key, queue.items()[i].key);
+        }
+        CHECK_EQ(queue.items().front().index, 9u);
+        CHECK_EQ(queue.items()[1].index, 19u);
+    }
+
+    TEST_CASE ("layer tags set the draw order")
+    {
+        entt::registry registry;
+        connect_layers(registry);
+        auto entity = registry.create();
+        registry.assign<layer_3>(entity);
+        REQUIRE(registry.has<draw_order>(entity));
+        CHECK_EQ(registry.get<draw_order>(entity).layer, 3u);
+        registry.remove<layer_3>(entity);
+        CHECK_FALSE(registry.has<draw_order>(entity));
+
+        //! an explicit depth survives the removal of the tag
+        registry.assign<draw_order>(entity, draw_order{0u, 2.5f});
+        registry.assign<layer_5>(entity);
+        CHECK_EQ(registry.get<draw_order>(entity).layer, 5u);
+        registry.remove<layer_5>(entity);
+        REQUIRE(registry.has<draw_order>(entity));
+        CHECK_EQ(registry.get<draw_order>(entity).layer, 0u);
+        CHECK_EQ(registry.get<draw_order>(entity).depth, 2.5f);
+    }
+}
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+#include "antara/gaming/graphics/texture.atlas.hpp"
+
+namespace antara::gaming::graphics::tests
+{
+    TEST_CASE ("atlas packer")
+    {
+        atlas_packer packer{math::vec2u{64u, 64u}, 0u};
+        auto first = packer.insert(math::vec2u{32u, 32u});
+        REQUIRE(first.has_value());
+        CHECK_EQ(first->page, 0u);
+        CHECK_EQ(first->area.pos, math::vec2f{0.f, 0.f});
+        auto second = packer.insert(math::vec2u{32u, 16u});
+        REQUIRE(second.has_value());
+        CHECK_EQ(second->area.pos, math::vec2f{32.f, 0.f});
+        auto third = packer.insert(math::vec2u{32u, 16u});
+        REQUIRE(third.has_value());
+        CHECK_EQ(third->area.pos, math::vec2f{32.f, 16.f});
+        auto fourth = packer.insert(math::vec2u{64u, 32u});
+        REQUIRE(fourth.has_value());
+        CHECK_EQ(fourth->area.pos, math::vec2f{0.f, 32.f});
+        CHECK_EQ(packer.nb_pages(), 1u);
+
+        //! page is full
+        auto fifth = packer.insert(math::vec2u{8u, 8u});
+        REQUIRE(fifth.has_value());
+        CHECK_EQ(fifth->page, 1u);
+        CHECK_EQ(packer.nb_pages(), 2u);
+        CHECK_FALSE(packer.insert(math::vec2u{128u, 8u}).has_value());
+    }
+
+    TEST_CASE ("atlas remap")
+    {
+        texture_atlas atlas;
+        atlas.regions["player.png"] = atlas_region{0u, rect{math::vec2f{64.f, 32.f}, math::vec2f{48.f, 16.f}}};
+        CHECK_EQ(atlas.find("enemy.png"), nullptr);
+        auto region = atlas.find("player.png");
+        REQUIRE_NE(region, nullptr);
+
+        sprite native{"player.png"};
+        auto whole = texture_atlas::remap(*region, native);
+        CHECK_EQ(whole.pos, math::vec2f{64.f, 32.f});
+        CHECK_EQ(whole.size, math::vec2f{48.f, 16.f});
+
+        sprite frame{"player.png", false, rect{math::vec2f{16.f, 0.f}, math::vec2f{16.f, 16.f}}};
+        auto sub = texture_atlas::remap(*region, frame);
+        CHECK_EQ(sub.pos, math::vec2f{80.f, 32.f});
+        CHECK_EQ(sub.size, math::vec2f{16.f, 16.f});
+    }
+}
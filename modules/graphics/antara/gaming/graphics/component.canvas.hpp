@@ -63,6 +63,7 @@ namespace antara::gaming::graphics {
         bool native_desktop_mode{false};
         bool is_fullscreen{false};
         bool vsync{false};
+        bool threaded_rendering{false}; //! draw and display from a dedicated render thread
         bool mouse_visible{true};
         bool mouse_grabbed{false};
         bool no_style{false};
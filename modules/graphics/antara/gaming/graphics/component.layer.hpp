@@ -18,13 +18,27 @@
 
 //! C System Headers
 #include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint32_t
+
+//! C++ System Headers
+#include <utility> ///< std::index_sequence
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry
 
 //! SDK Headers
 #include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
 
 namespace antara::gaming::graphics {
+    //! Number of layer<N> tag aliases, draw_order::layer itself is not limited by it.
     inline constexpr std::size_t max_layer = 12ull;
 
+    //! Position of a drawable in the render queue: sorted by layer then by depth (lower is drawn first)
+    struct draw_order {
+        std::uint32_t layer{0u};
+        float depth{0.f};
+    };
+
     template<std::size_t N>
     struct layer {
     };
@@ -41,8 +55,46 @@ namespace antara::gaming::graphics {
     using layer_9 = layer<9>;
     using layer_10 = layer<10>;
     using layer_11 = layer<11>;
+
+    template<std::size_t N>
+    void on_layer_construct(entt::entity entity, entt::registry &registry, const layer<N> &) noexcept {
+        if (auto order = registry.try_get<draw_order>(entity); order != nullptr) {
+            order->layer = static_cast<std::uint32_t>(N);
+        } else {
+            registry.assign<draw_order>(entity, draw_order{static_cast<std::uint32_t>(N)});
+        }
+    }
+
+    template<std::size_t N>
+    void on_layer_destroy(entt::entity entity, entt::registry &registry) noexcept {
+        auto order = registry.try_get<draw_order>(entity);
+        if (order == nullptr) {
+            return;
+        }
+        //! an explicit depth was set by the user, only the layer part came from the tag
+        if (order->depth != 0.f) {
+            order->layer = 0u;
+        } else {
+            registry.remove<draw_order>(entity);
+        }
+    }
+
+    template<std::size_t... Is>
+    void connect_layers(entt::registry &registry, std::index_sequence<Is...>) noexcept {
+        ((registry.on_construct<layer<Is>>().template connect<&on_layer_construct<Is>>()), ...);
+        ((registry.on_destroy<layer<Is>>().template connect<&on_layer_destroy<Is>>()), ...);
+    }
+
+    /**
+     * @brief keep the layer<N> tags working on top of draw_order: assigning layer<N> sets draw_order::layer to N.
+     * @param registry the registry to connect to
+     */
+    inline void connect_layers(entt::registry &registry) noexcept {
+        connect_layers(registry, std::make_index_sequence<max_layer>{});
+    }
 }
 
+REFL_AUTO(type(antara::gaming::graphics::draw_order), field(layer), field(depth))
 REFL_AUTO(type(antara::gaming::graphics::layer_0))
 REFL_AUTO(type(antara::gaming::graphics::layer_1))
 REFL_AUTO(type(antara::gaming::graphics::layer_2))
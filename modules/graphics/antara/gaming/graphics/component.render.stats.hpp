@@ -0,0 +1,48 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+
+//! SDK Headers
+#include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
+
+namespace antara::gaming::graphics {
+    //! Render statistics of the last frame, stored in the registry context by the graphic system
+    struct render_stats {
+        std::size_t draw_calls{0u}; //! number of draw calls issued
+        std::size_t vertices{0u}; //! number of vertices submitted
+        std::size_t texture_switches{0u}; //! number of times the bound texture changed between two draw calls
+        std::size_t render_texture_clears{0u}; //! number of render texture cleared (the canvas included)
+        std::size_t culled_entities{0u}; //! number of drawables skipped because they are outside of the canvas
+        float draw_time_ms{0.f}; //! time spent in draw_all_layers
+        float display_time_ms{0.f}; //! time spent to present the canvas on the window
+
+        //! reset the counters, timings are overwritten every frame
+        void reset_counters() noexcept {
+            draw_calls = 0u;
+            vertices = 0u;
+            texture_switches = 0u;
+            render_texture_clears = 0u;
+            culled_entities = 0u;
+        }
+    };
+}
+
+REFL_AUTO(type(antara::gaming::graphics::render_stats), field(draw_calls), field(vertices), field(texture_switches),
+          field(render_texture_clears), field(culled_entities), field(draw_time_ms), field(display_time_ms))
@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C System Headers
+#include <cstring> ///< std::memcpy
+
+//! C++ System Headers
+#include <algorithm> ///< std::min
+#include <array> ///< std::array
+
+//! SDK Headers
+#include "antara/gaming/graphics/render.queue.hpp"
+
+namespace {
+    using antara::gaming::graphics::render_queue;
+
+    constexpr std::uint64_t mask(std::uint64_t bits) noexcept {
+        return (std::uint64_t{1} << bits) - 1u;
+    }
+
+    constexpr std::uint64_t type_shift = 0u;
+    constexpr std::uint64_t texture_shift = type_shift + render_queue::type_bits;
+    constexpr std::uint64_t depth_shift = texture_shift + render_queue::texture_bits;
+    constexpr std::uint64_t layer_shift = depth_shift + render_queue::depth_bits;
+    static_assert(layer_shift + render_queue::layer_bits == 64u, "sort key must use the 64 bits");
+
+    //! Above this number of descents the frame is considered reshuffled and radix sorted straight away
+    constexpr std::size_t max_insertion_descents = 32u;
+
+    //! Element moves allowed per drawable before the insertion sort gives up, keeps the worst case linear
+    constexpr std::size_t insertion_moves_per_item = 4u;
+
+    //! Map a float to an unsigned integer with the same ordering
+    std::uint32_t sortable_depth(float depth) noexcept {
+        std::uint32_t bits;
+        std::memcpy(&bits, &depth, sizeof(bits));
+        return (bits & 0x80000000u) != 0u ? ~bits : bits | 0x80000000u;
+    }
+}
+
+namespace antara::gaming::graphics {
+    std::uint64_t
+    render_queue::make_key(std::uint32_t layer, float depth, std::uint32_t texture, std::uint32_t type) noexcept {
+        std::uint64_t key = std::min<std::uint64_t>(layer, mask(layer_bits)) << layer_shift;
+        key |= (std::uint64_t{sortable_depth(depth)} >> (32u - depth_bits)) << depth_shift;
+        key |= (texture & mask(texture_bits)) << texture_shift;
+        key |= (type & mask(type_bits)) << type_shift;
+        return key;
+    }
+
+    std::uint32_t render_queue::layer_of(std::uint64_t key) noexcept {
+        return static_cast<std::uint32_t>((key >> layer_shift) & mask(layer_bits));
+    }
+
+    std::uint32_t render_queue::type_of(std::uint64_t key) noexcept {
+        return static_cast<std::uint32_t>((key >> type_shift) & mask(type_bits));
+    }
+
+    void render_queue::clear() noexcept {
+        keys_.clear();
+    }
+
+    std::uint32_t render_queue::push(std::uint64_t key) noexcept {
+        keys_.push_back(key);
+        return static_cast<std::uint32_t>(keys_.size() - 1u);
+    }
+
+    void render_queue::sort() noexcept {
+        const auto nb_items = keys_.size();
+        sorted_.resize(nb_items);
+        if (previous_order_.size() == nb_items) {
+            //! Temporal coherence: start from the order of the previous frame
+            for (std::size_t i = 0; i < nb_items; ++i) {
+                auto index = previous_order_[i];
+                sorted_[i] = item{keys_[index], index};
+            }
+        } else {
+            for (std::size_t i = 0; i < nb_items; ++i) {
+                sorted_[i] = item{keys_[i], static_cast<std::uint32_t>(i)};
+            }
+        }
+
+        std::size_t nb_descents = 0u;
+        for (std::size_t i = 1; i < nb_items; ++i) {
+            if (sorted_[i].key < sorted_[i - 1].key) {
+                ++nb_descents;
+            }
+        }
+
+        if (nb_descents > 0u) {
+            //! A handful of drawables moved by a short distance is cheaper to insert than to radix sort the whole frame
+            const bool is_nearly_sorted = nb_descents <= max_insertion_descents &&
+                                          insertion_sort_(insertion_moves_per_item * nb_items);
+            if (not is_nearly_sorted) {
+                radix_sort_();
+            }
+        }
+
+        previous_order_.resize(nb_items);
+        for (std::size_t i = 0; i < nb_items; ++i) {
+            previous_order_[i] = sorted_[i].index;
+        }
+    }
+
+    bool render_queue::insertion_sort_(std::size_t max_moves) noexcept {
+        std::size_t nb_moves = 0u;
+        for (std::size_t i = 1; i < sorted_.size(); ++i) {
+            auto current = sorted_[i];
+            auto j = i;
+            while (j > 0 && current.key < sorted_[j - 1].key) {
+                sorted_[j] = sorted_[j - 1];
+                --j;
+            }
+            sorted_[j] = current;
+            nb_moves += i - j;
+            //! the partial result stays a stable permutation, the radix sort can finish from there
+            if (nb_moves > max_moves) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void render_queue::radix_sort_() noexcept {
+        ++nb_radix_sorts_;
+        constexpr std::size_t nb_passes = sizeof(std::uint64_t);
+        std::array<std::array<std::size_t, 256>, nb_passes> histograms{};
+        for (auto &&current : sorted_) {
+            for (std::size_t pass = 0; pass < nb_passes; ++pass) {
+                ++histograms[pass][(current.key >> (pass * 8u)) & 0xFFu];
+            }
+        }
+
+        scratch_.resize(sorted_.size());
+        for (std::size_t pass = 0; pass < nb_passes; ++pass) {
+            auto &histogram = histograms[pass];
+            //! Every key share the same byte, the pass would not move anything
+            if (histogram[(sorted_.front().key >> (pass * 8u)) & 0xFFu] == sorted_.size()) {
+                continue;
+            }
+            std::size_t offset = 0u;
+            for (auto &&count : histogram) {
+                auto current_count = count;
+                count = offset;
+                offset += current_count;
+            }
+            for (auto &&current : sorted_) {
+                scratch_[histogram[(current.key >> (pass * 8u)) & 0xFFu]++] = current;
+            }
+            sorted_.swap(scratch_);
+        }
+    }
+
+    const std::vector<render_queue::item> &render_queue::items() const noexcept {
+        return sorted_;
+    }
+
+    std::size_t render_queue::size() const noexcept {
+        return sorted_.size();
+    }
+
+    std::size_t render_queue::nb_radix_sorts() const noexcept {
+        return nb_radix_sorts_;
+    }
+}
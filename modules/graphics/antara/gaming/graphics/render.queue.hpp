@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t, std::uint32_t
+
+//! C++ System Headers
+#include <vector> ///< std::vector
+
+namespace antara::gaming::graphics {
+    /**
+     * @class render_queue
+     * @brief Frame array of 64 bits sort keys (layer, depth, texture, type) radix sorted before submission.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The queue remembers the order of the previous frame: as long as the drawables are pushed in the same order,
+     *         the previous permutation is applied first and a nearly sorted frame is finished by an insertion sort
+     *         bounded to a linear number of moves. The radix sort is used when the frame changed a lot.
+     * @endverbatim
+     */
+    class render_queue {
+    public:
+        //! Key layout, from most to least significant bits
+        static constexpr std::uint64_t layer_bits = 24u;
+        static constexpr std::uint64_t depth_bits = 20u;
+        static constexpr std::uint64_t texture_bits = 16u;
+        static constexpr std::uint64_t type_bits = 4u;
+
+        struct item {
+            std::uint64_t key;
+            std::uint32_t index; //! position of the drawable in the push order of the frame
+        };
+
+        //! Public static functions
+        [[nodiscard]] static std::uint64_t
+        make_key(std::uint32_t layer, float depth, std::uint32_t texture, std::uint32_t type) noexcept;
+
+        [[nodiscard]] static std::uint32_t layer_of(std::uint64_t key) noexcept;
+
+        [[nodiscard]] static std::uint32_t type_of(std::uint64_t key) noexcept;
+
+        //! Public member functions
+
+        /// @brief start a new frame, the order of the previous one is kept for the next sort.
+        void clear() noexcept;
+
+        /**
+         * @brief push a drawable in the frame.
+         * @return the index of the drawable, which is given back by items() once sorted.
+         */
+        std::uint32_t push(std::uint64_t key) noexcept;
+
+        /// @brief sort the frame by key, equal keys keep the order of the previous frame (push order on the first one).
+        void sort() noexcept;
+
+        //! Public getters
+        [[nodiscard]] const std::vector<item> &items() const noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        //! Number of sorts that needed a full radix sort, for diagnostics
+        [[nodiscard]] std::size_t nb_radix_sorts() const noexcept;
+
+    private:
+        //! Private member functions
+        //! Stable insertion sort, gives up and returns false after max_moves element moves
+        bool insertion_sort_(std::size_t max_moves) noexcept;
+
+        void radix_sort_() noexcept;
+
+        //! Private fields
+        std::vector<std::uint64_t> keys_;
+        std::vector<item> sorted_;
+        std::vector<item> scratch_;
+        std::vector<std::uint32_t> previous_order_;
+        std::size_t nb_radix_sorts_{0u};
+    };
+}
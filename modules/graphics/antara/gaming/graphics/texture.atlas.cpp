@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <algorithm> ///< std::max
+#include <limits> ///< std::numeric_limits
+
+//! SDK Headers
+#include "antara/gaming/graphics/texture.atlas.hpp"
+
+namespace antara::gaming::graphics {
+    atlas_packer::atlas_packer(math::vec2u page_size, unsigned padding) noexcept : page_size_(page_size),
+                                                                                  padding_(padding) {
+    }
+
+    std::optional<atlas_region> atlas_packer::insert(math::vec2u size) noexcept {
+        const unsigned width = size.x() + padding_;
+        const unsigned height = size.y() + padding_;
+        if (width > page_size_.x() || height > page_size_.y()) {
+            return std::nullopt;
+        }
+
+        for (std::size_t page = 0; page <= pages_.size(); ++page) {
+            if (page == pages_.size()) {
+                pages_.push_back(skyline{skyline_node{0u, 0u, page_size_.x()}});
+            }
+            if (auto pos = insert_in_page_(pages_[page], width, height); pos.has_value()) {
+                auto[x, y] = pos.value();
+                return atlas_region{page, rect{math::vec2f{float(x), float(y)},
+                                               math::vec2f{float(size.x()), float(size.y())}}};
+            }
+        }
+        return std::nullopt; //! LCOV_EXCL_LINE
+    }
+
+    std::optional<math::vec2u>
+    atlas_packer::insert_in_page_(skyline &page, unsigned width, unsigned height) noexcept {
+        std::size_t best_index = page.size();
+        unsigned best_y = std::numeric_limits<unsigned>::max();
+        unsigned best_width = std::numeric_limits<unsigned>::max();
+
+        //! lowest position first, then the narrowest segment to keep the skyline flat
+        for (std::size_t i = 0; i < page.size(); ++i) {
+            const unsigned x = page[i].x;
+            if (x + width > page_size_.x()) {
+                break;
+            }
+            unsigned y = 0u;
+            unsigned remaining = width;
+            for (std::size_t j = i; remaining > 0u; ++j) {
+                y = std::max(y, page[j].y);
+                remaining -= std::min(remaining, page[j].width);
+            }
+            if (y + height > page_size_.y()) {
+                continue;
+            }
+            if (y < best_y || (y == best_y && page[i].width < best_width)) {
+                best_index = i;
+                best_y = y;
+                best_width = page[i].width;
+            }
+        }
+
+        if (best_index == page.size()) {
+            return std::nullopt;
+        }
+
+        const unsigned x = page[best_index].x;
+        page.insert(page.begin() + best_index, skyline_node{x, best_y + height, width});
+
+        //! shrink or remove the segments now covered by the new one
+        for (std::size_t i = best_index + 1; i < page.size();) {
+            const unsigned previous_end = page[i - 1].x + page[i - 1].width;
+            if (page[i].x >= previous_end) {
+                break;
+            }
+            const unsigned shrink = previous_end - page[i].x;
+            if (page[i].width <= shrink) {
+                page.erase(page.begin() + i);
+                continue;
+            }
+            page[i].x += shrink;
+            page[i].width -= shrink;
+            break;
+        }
+
+        //! merge neighbours of the same height
+        for (std::size_t i = 0; i + 1 < page.size();) {
+            if (page[i].y == page[i + 1].y) {
+                page[i].width += page[i + 1].width;
+                page.erase(page.begin() + i + 1);
+            } else {
+                ++i;
+            }
+        }
+        return math::vec2u{x, best_y};
+    }
+
+    std::size_t atlas_packer::nb_pages() const noexcept {
+        return pages_.size();
+    }
+
+    math::vec2u atlas_packer::page_size() const noexcept {
+        return page_size_;
+    }
+
+    const atlas_region *texture_atlas::find(const std::string &appearance) const noexcept {
+        if (auto it = regions.find(appearance); it != regions.end()) {
+            return &it->second;
+        }
+        return nullptr;
+    }
+
+    rect texture_atlas::remap(const atlas_region &region, const sprite &spr) noexcept {
+        if (spr.native_size) {
+            return region.area;
+        }
+        return rect{region.area.pos + spr.texture_rec.pos, spr.texture_rec.size};
+    }
+}
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+
+//! C++ System Headers
+#include <optional> ///< std::optional
+#include <string> ///< std::string
+#include <unordered_map> ///< std::unordered_map
+#include <vector> ///< std::vector
+
+//! SDK Headers
+#include "antara/gaming/graphics/component.sprite.hpp" ///< graphics::rect, graphics::sprite
+#include "antara/gaming/math/vector.hpp" ///< math::vec2u
+
+namespace antara::gaming::graphics {
+    //! Place of a texture inside an atlas
+    struct atlas_region {
+        std::size_t page{0u};
+        rect area{};
+    };
+
+    /**
+     * @class atlas_packer
+     * @brief Skyline bottom-left bin packer, fills fixed size pages and opens a new page when a rectangle does not fit.
+     */
+    class atlas_packer {
+    public:
+        //! Constructors
+        explicit atlas_packer(math::vec2u page_size, unsigned padding = 2u) noexcept;
+
+        //! Public member functions
+
+        /**
+         * @param size size of the rectangle to place
+         * @return the region of the rectangle, std::nullopt if it is bigger than a page
+         */
+        std::optional<atlas_region> insert(math::vec2u size) noexcept;
+
+        //! Public getters
+        [[nodiscard]] std::size_t nb_pages() const noexcept;
+
+        [[nodiscard]] math::vec2u page_size() const noexcept;
+
+    private:
+        //! Private typedefs
+        struct skyline_node {
+            unsigned x;
+            unsigned y;
+            unsigned width;
+        };
+        using skyline = std::vector<skyline_node>;
+
+        //! Private member functions
+        std::optional<math::vec2u> insert_in_page_(skyline &page, unsigned width, unsigned height) noexcept;
+
+        //! Private fields
+        math::vec2u page_size_;
+        unsigned padding_;
+        std::vector<skyline> pages_;
+    };
+
+    //! Textures packed in atlas pages, sprites whose appearance is listed here are drawn from the atlas page.
+    struct texture_atlas {
+        std::unordered_map<std::string, atlas_region> regions; //! appearance -> region
+        std::vector<std::string> pages; //! texture ids of the pages
+
+        [[nodiscard]] const atlas_region *find(const std::string &appearance) const noexcept;
+
+        /**
+         * @return the texture_rec of the sprite (the whole texture if native_size) translated inside its atlas page
+         */
+        [[nodiscard]] static rect remap(const atlas_region &region, const sprite &spr) noexcept;
+    };
+}
@@ -106,6 +106,32 @@ namespace antara::gaming::lua::tests
                 CHECK_EQ(res, input::key::return_);
     }
 
+    TEST_CASE_FIXTURE (lua_tests_fixture, "bindings are registered on first use")
+    {
+        sol::table antara_table = state["antara"];
+                CHECK(antara_table.raw_get<sol::object>("keyboard").get_type() == sol::type::lua_nil);
+                CHECK(state.globals().raw_get<sol::object>("position_2d").get_type() == sol::type::lua_nil);
+        bool res = state.script("return position_2d ~= nil and antara.keyboard.space ~= nil and undefined_global == nil");
+                CHECK(res);
+                CHECK(antara_table.raw_get<sol::object>("keyboard").get_type() == sol::type::table);
+                CHECK(state.globals().raw_get<sol::object>("position_2d").get_type() != sol::type::lua_nil);
+        res = state.script("return undefined_global == nil and antara.undefined_field == nil");
+                CHECK(res);
+    }
+
+    TEST_CASE_FIXTURE (lua_tests_fixture, "the lua state can outlive its system")
+    {
+        std::shared_ptr<sol::state> shared_state;
+        {
+            const auto scripts_path = std::filesystem::current_path() / "lua_assets" / "scripts";
+            scripting_system other_sys{entity_registry, scripts_path, scripts_path / "systems",
+                                       scripts_path / "scenes" / "lua", scripts_path / "lib"};
+            shared_state = other_sys.get_state_ptr();
+        }
+        bool res = shared_state->script("return position_2d == nil and antara.keyboard == nil");
+                CHECK(res);
+    }
+
     TEST_CASE_FIXTURE (lua_tests_fixture, "mouse input")
     {
         input::mouse_button res = state.script("return antara.mouse_button.right");
@@ -26,6 +26,8 @@
 #include "antara/gaming/lua/component.lua.hpp" /// lua::component_script
 #include "antara/gaming/lua/details/lua.scripted.system.hpp" ///< lua::details::scripted_system
 #include "antara/gaming/lua/lua.system.hpp"
+#include "antara/gaming/timer/frame.recorder.hpp" ///< timer::frame_recorder
+#include "antara/gaming/timer/startup.trace.hpp" ///< timer::startup_trace
 
 namespace antara::gaming::lua {
     void scripting_system::update() noexcept {
@@ -45,16 +47,22 @@ namespace antara::gaming::lua {
             scenes_directory_path_(std::move(script_scenes_directory)),
             script_lib_directory_(std::move(script_lib_directory)) {
         lua_state_->open_libraries();
+        auto bindings_scope = timer::startup_trace::shared().measure("lua bindings");
+        install_lazy_bindings_(lua_state_->globals(), "");
         register_entity_registry();
         lua_state_->new_usertype<entt::dispatcher>("dispatcher");
         assert(fs::exists(scenes_directory_path_));
         assert(fs::exists(systems_directory_path_));
         assert(fs::exists(script_lib_directory_));
         assert(fs::exists(directory_path_));
-        auto res = this->load_scripts(script_lib_directory_);
-        if (!res)
-            std::abort();
+        {
+            auto lib_scope = timer::startup_trace::shared().measure("lua lib scripts", script_lib_directory_.string());
+            auto res = this->load_scripts(script_lib_directory_);
+            if (!res)
+                std::abort();
+        }
         sol::table table = lua_state_->create_table_with("version", gaming::version());
+        install_lazy_bindings_(table, "antara.");
         table.new_enum<ecs::system_type>("system_type", {
                 {"pre_update",   ecs::pre_update},
                 {"post_update",  ecs::post_update},
@@ -70,109 +78,113 @@ namespace antara::gaming::lua {
                 {"quads",        geometry::vertex_geometry_type::quads},
         });
 
-        table.new_enum<input::key>("keyboard", {
-                {"a",             input::key::a},
-                {"b",             input::key::b},
-                {"c",             input::key::c},
-                {"d",             input::key::d},
-                {"e",             input::key::e},
-                {"f",             input::key::f},
-                {"g",             input::key::g},
-                {"h",             input::key::h},
-                {"i",             input::key::i},
-                {"j",             input::key::j},
-                {"k",             input::key::k},
-                {"l",             input::key::l},
-                {"m",             input::key::m},
-                {"n",             input::key::n},
-                {"o",             input::key::o},
-                {"p",             input::key::p},
-                {"q",             input::key::q},
-                {"r",             input::key::r},
-                {"s",             input::key::s},
-                {"t",             input::key::t},
-                {"u",             input::key::u},
-                {"v",             input::key::v},
-                {"w",             input::key::w},
-                {"x",             input::key::x},
-                {"y",             input::key::y},
-                {"z",             input::key::z},
-                {"num_0",         input::key::num_0},
-                {"num_1",         input::key::num_1},
-                {"num_2",         input::key::num_2},
-                {"num_3",         input::key::num_3},
-                {"num_4",         input::key::num_4},
-                {"num_5",         input::key::num_5},
-                {"num_6",         input::key::num_6},
-                {"num_7",         input::key::num_7},
-                {"num_8",         input::key::num_8},
-                {"num_9",         input::key::num_9},
-                {"escape",        input::key::escape},
-                {"left_control",  input::key::left_control},
-                {"left_shift",    input::key::left_shift},
-                {"left_alt",      input::key::left_alt},
-                {"left_system",   input::key::left_system},
-                {"right_control", input::key::right_control},
-                {"right_shift",   input::key::right_shift},
-                {"right_alt",     input::key::right_alt},
-                {"right_system",  input::key::right_system},
-                {"menu",          input::key::menu},
-                {"left_bracket",  input::key::left_bracket},
-                {"right_bracket", input::key::right_bracket},
-                {"semi_colon",    input::key::semi_colon},
-                {"comma",         input::key::comma},
-                {"period",        input::key::period},
-                {"quote",         input::key::quote},
-                {"slack",         input::key::slash},
-                {"back_slash",    input::key::back_slash},
-                {"tilde",         input::key::tilde},
-                {"equal",         input::key::equal},
-                {"dash",          input::key::dash},
-                {"space",         input::key::space},
-                {"return_",       input::key::return_},
-                {"back_space",    input::key::back_space},
-                {"tab",           input::key::tab},
-                {"page_up",       input::key::page_up},
-                {"page_down",     input::key::page_down},
-                {"end",           input::key::end},
-                {"home",          input::key::home},
-                {"insert",        input::key::insert},
-                {"delete_",       input::key::delete_},
-                {"add",           input::key::add},
-                {"subtract",      input::key::subtract},
-                {"multiply",      input::key::multiply},
-                {"divide",        input::key::divide},
-                {"left",          input::key::left},
-                {"right",         input::key::right},
-                {"up",            input::key::up},
-                {"down",          input::key::down},
-                {"numpad_0",      input::key::numpad_0},
-                {"numpad_1",      input::key::numpad_1},
-                {"numpad_2",      input::key::numpad_2},
-                {"numpad_3",      input::key::numpad_3},
-                {"numpad_4",      input::key::numpad_4},
-                {"numpad_5",      input::key::numpad_5},
-                {"numpad_6",      input::key::numpad_6},
-                {"numpad_7",      input::key::numpad_7},
-                {"numpad_8",      input::key::numpad_8},
-                {"numpad_9",      input::key::numpad_9},
-                {"f1",            input::key::f1},
-                {"f2",            input::key::f2},
-                {"f3",            input::key::f3},
-                {"f4",            input::key::f4},
-                {"f5",            input::key::f5},
-                {"f6",            input::key::f6},
-                {"f7",            input::key::f7},
-                {"f8",            input::key::f8},
-                {"f9",            input::key::f9},
-                {"f10",           input::key::f10},
-                {"f11",           input::key::f11},
-                {"f12",           input::key::f12},
-                {"f13",           input::key::f13},
-                {"f14",           input::key::f14},
-                {"f15",           input::key::f15},
-                {"pause",         input::key::pause},
-        });
+        //! ~100 entries, only built when a script reads antara.keyboard
+        lazy_bindings_["antara.keyboard"] = [this]() {
+            sol::table antara_table = (*this->lua_state_)["antara"];
+            antara_table.new_enum<input::key>("keyboard", {
+                    {"a",             input::key::a},
+                    {"b",             input::key::b},
+                    {"c",             input::key::c},
+                    {"d",             input::key::d},
+                    {"e",             input::key::e},
+                    {"f",             input::key::f},
+                    {"g",             input::key::g},
+                    {"h",             input::key::h},
+                    {"i",             input::key::i},
+                    {"j",             input::key::j},
+                    {"k",             input::key::k},
+                    {"l",             input::key::l},
+                    {"m",             input::key::m},
+                    {"n",             input::key::n},
+                    {"o",             input::key::o},
+                    {"p",             input::key::p},
+                    {"q",             input::key::q},
+                    {"r",             input::key::r},
+                    {"s",             input::key::s},
+                    {"t",             input::key::t},
+                    {"u",             input::key::u},
+                    {"v",             input::key::v},
+                    {"w",             input::key::w},
+                    {"x",             input::key::x},
+                    {"y",             input::key::y},
+                    {"z",             input::key::z},
+                    {"num_0",         input::key::num_0},
+                    {"num_1",         input::key::num_1},
+                    {"num_2",         input::key::num_2},
+                    {"num_3",         input::key::num_3},
+                    {"num_4",         input::key::num_4},
+                    {"num_5",         input::key::num_5},
+                    {"num_6",         input::key::num_6},
+                    {"num_7",         input::key::num_7},
+                    {"num_8",         input::key::num_8},
+                    {"num_9",         input::key::num_9},
+                    {"escape",        input::key::escape},
+                    {"left_control",  input::key::left_control},
+                    {"left_shift",    input::key::left_shift},
+                    {"left_alt",      input::key::left_alt},
+                    {"left_system",   input::key::left_system},
+                    {"right_control", input::key::right_control},
+                    {"right_shift",   input::key::right_shift},
+                    {"right_alt",     input::key::right_alt},
+                    {"right_system",  input::key::right_system},
+                    {"menu",          input::key::menu},
+                    {"left_bracket",  input::key::left_bracket},
+                    {"right_bracket", input::key::right_bracket},
+                    {"semi_colon",    input::key::semi_colon},
+                    {"comma",         input::key::comma},
+                    {"period",        input::key::period},
+                    {"quote",         input::key::quote},
+                    {"slack",         input::key::slash},
+                    {"back_slash",    input::key::back_slash},
+                    {"tilde",         input::key::tilde},
+                    {"equal",         input::key::equal},
+                    {"dash",          input::key::dash},
+                    {"space",         input::key::space},
+                    {"return_",       input::key::return_},
+                    {"back_space",    input::key::back_space},
+                    {"tab",           input::key::tab},
+                    {"page_up",       input::key::page_up},
+                    {"page_down",     input::key::page_down},
+                    {"end",           input::key::end},
+                    {"home",          input::key::home},
+                    {"insert",        input::key::insert},
+                    {"delete_",       input::key::delete_},
+                    {"add",           input::key::add},
+                    {"subtract",      input::key::subtract},
+                    {"multiply",      input::key::multiply},
+                    {"divide",        input::key::divide},
+                    {"left",          input::key::left},
+                    {"right",         input::key::right},
+                    {"up",            input::key::up},
+                    {"down",          input::key::down},
+                    {"numpad_0",      input::key::numpad_0},
+                    {"numpad_1",      input::key::numpad_1},
+                    {"numpad_2",      input::key::numpad_2},
+                    {"numpad_3",      input::key::numpad_3},
+                    {"numpad_4",      input::key::numpad_4},
+                    {"numpad_5",      input::key::numpad_5},
+                    {"numpad_6",      input::key::numpad_6},
+                    {"numpad_7",      input::key::numpad_7},
+                    {"numpad_8",      input::key::numpad_8},
+                    {"numpad_9",      input::key::numpad_9},
+                    {"f1",            input::key::f1},
+                    {"f2",            input::key::f2},
+                    {"f3",            input::key::f3},
+                    {"f4",            input::key::f4},
+                    {"f5",            input::key::f5},
+                    {"f6",            input::key::f6},
+                    {"f7",            input::key::f7},
+                    {"f8",            input::key::f8},
+                    {"f9",            input::key::f9},
+                    {"f10",           input::key::f10},
+                    {"f11",           input::key::f11},
+                    {"f12",           input::key::f12},
+                    {"f13",           input::key::f13},
+                    {"f14",           input::key::f14},
+                    {"f15",           input::key::f15},
+                    {"pause",         input::key::pause},
+            });
+        };
 
         table.new_enum<input::mouse_button>("mouse_button", {
                 {"left",       input::mouse_button::left},
@@ -199,6 +211,25 @@ namespace antara::gaming::lua {
             }
             return std::make_tuple(path_scenes_entries, filename_scenes);
         };
+        (*this->lua_state_)["antara"]["get_frame_stats"] = [this]() {
+            auto to_ms = [](std::chrono::nanoseconds duration) {
+                return std::chrono::duration<double, std::milli>(duration).count();
+            };
+            sol::table stats = lua_state_->create_table();
+            if (auto recorder = entity_registry_.try_ctx<timer::frame_recorder>(); recorder != nullptr) {
+                auto pct = recorder->window_percentiles();
+                stats["nb_frames"] = recorder->nb_frames();
+                stats["p50_ms"] = to_ms(pct.p50);
+                stats["p95_ms"] = to_ms(pct.p95);
+                stats["p99_ms"] = to_ms(pct.p99);
+                stats["max_ms"] = to_ms(pct.max);
+                stats["mean_logic_ticks"] = recorder->mean_logic_ticks();
+                stats["max_logic_ticks"] = recorder->max_logic_ticks();
+                stats["max_lag_ms"] = to_ms(recorder->max_lag());
+            }
+            return stats;
+        };
+        bind_type_<graphics::color>();
         (*this->lua_state_)["antara"]["color_black"] = graphics::black;
         (*this->lua_state_)["antara"]["color_magenta"] = graphics::magenta;
         (*this->lua_state_)["antara"]["color_cyan"] = graphics::cyan;
@@ -239,6 +270,43 @@ namespace antara::gaming::lua {
         };
     }
 
+    void scripting_system::install_lazy_bindings_(sol::table table, std::string prefix) noexcept {
+        sol::table metatable = lua_state_->create_table();
+        metatable["__index"] = [this, prefix = std::move(prefix)](sol::table self, sol::object key) -> sol::object {
+            //! misses stay cheap: nothing is built once every binding is resolved, or for a key which is not a string
+            if (this->lazy_bindings_.empty() || key.get_type() != sol::type::string ||
+                not this->resolve_lazy_binding_(prefix + key.as<std::string>())) {
+                return sol::object(sol::lua_nil);
+            }
+            auto value = self.raw_get<sol::object>(key);
+            //! stored in the table itself, the next lookups of this name never reach __index again
+            self.raw_set(key, value);
+            return value;
+        };
+        table[sol::metatable_key] = metatable;
+    }
+
+    scripting_system::~scripting_system() noexcept {
+        //! the state is shared and may outlive the system, remove the __index metamethods which capture this
+        sol::table globals = lua_state_->globals();
+        if (auto antara_table = globals.raw_get<sol::optional<sol::table>>("antara"); antara_table.has_value()) {
+            antara_table.value()[sol::metatable_key] = sol::lua_nil;
+        }
+        globals[sol::metatable_key] = sol::lua_nil;
+    }
+
+    bool scripting_system::resolve_lazy_binding_(const std::string &name) noexcept {
+        auto it = lazy_bindings_.find(name);
+        if (it == lazy_bindings_.end()) {
+            return false;
+        }
+        auto binding = std::move(it->second);
+        lazy_bindings_.erase(it);
+        DVLOG_F(loguru::Verbosity_INFO, "lazy lua binding of {}", name);
+        binding();
+        return true;
+    }
+
     sol::state &scripting_system::get_state() noexcept {
         return (*this->lua_state_);
     }
@@ -291,6 +359,7 @@ namespace antara::gaming::lua {
     bool
     scripting_system::load_script(const std::string &file_name,
                                   const fs::path &script_directory) noexcept {
+        auto trace_scope = timer::startup_trace::shared().measure("lua script", file_name);
         try {
             this->lua_state_->script_file((script_directory / file_name).string());
         }
@@ -18,11 +18,13 @@
 
 //! C++ System Headers
 #include <exception> ///< std::exception
-#include <functional> ///< std::ref
+#include <functional> ///< std::ref, std::function
 #include <filesystem> ///< std::filesystem::path
 #include <memory> ///< std::shared_ptr
 #include <string> ///< std::string
+#include <unordered_map> ///< std::unordered_map
 #include <utility> ///< std::forward
+#include <vector> ///< std::vector
 
 //! Dependencies Headers
 #include <entt/entity/registry.hpp> ///< entt::registry
@@ -33,6 +35,7 @@
 //! SDK Headers
 #include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
 #include "antara/gaming/core/real.path.hpp" ///< core::assets_real_path()
+#include "antara/gaming/ecs/group.declaration.hpp" ///< ecs::component_id_of
 #include "antara/gaming/ecs/system.hpp" ///< ecs::system
 #include "antara/gaming/event/type.traits.hpp" ///< event::invoker
 
@@ -50,12 +53,28 @@ namespace antara::gaming::lua {
 
         void register_entity_registry();
 
+        template<typename TypeToRegister>
+        static std::string short_name_() noexcept;
+
+        //! Lazy bindings, see bind_type_
+        template<typename TypeToRegister>
+        void register_type_lazily_() noexcept;
+
+        template<typename TypeToRegister>
+        void bind_type_() noexcept;
+
+        void install_lazy_bindings_(sol::table table, std::string prefix) noexcept;
+
+        bool resolve_lazy_binding_(const std::string &name) noexcept;
+
         //! Private fields
         std::shared_ptr<sol::state> lua_state_{std::make_shared<sol::state>()};
         fs::path directory_path_;
         fs::path systems_directory_path_;
         fs::path scenes_directory_path_;
         fs::path script_lib_directory_;
+        std::unordered_map<std::string, std::function<void()>> lazy_bindings_; ///< by global name, run on first access
+        std::vector<bool> bound_types_; ///< indexed by ecs::component_id_of
     public:
         //! Constructor
         scripting_system(entt::registry &entity_registry,
@@ -65,7 +84,7 @@ namespace antara::gaming::lua {
                          fs::path script_lib_directory = core::assets_real_path() / "scripts" / "lib" / "lua") noexcept;
 
         //! Destructor
-        ~scripting_system() noexcept final = default;
+        ~scripting_system() noexcept final;
 
         //! Public member functions
         void update() noexcept final;
@@ -25,7 +25,8 @@ namespace antara::gaming::lua {
     template<typename TEvent>
     void scripting_system::register_event() noexcept {
         using namespace std::string_literals;
-        this->register_type<TEvent>();
+        //! bound right away: scripted systems push the events to lua without going through the scripting system
+        this->bind_type_<TEvent>();
         if constexpr (std::is_default_constructible_v<TEvent>) {
             constexpr auto info = refl::reflect<TEvent>();
             std::string final_name = info.name.str();
@@ -46,15 +47,13 @@ namespace antara::gaming::lua {
     template<typename TComponent>
     void scripting_system::register_component() noexcept {
         using namespace std::literals;
-        this->register_type<TComponent>();
-        constexpr auto info = refl::reflect<TComponent>();
-        std::string final_name = info.name.str();
-        if (std::size_t found = info.name.str().find_last_of(":"); found != std::string::npos) {
-            final_name = info.name.str().substr(found + 1);
-        }
+        //! the usertype is registered on first use, the helpers pushing a component bind it beforehand
+        this->register_type_lazily_<TComponent>();
+        const std::string final_name = short_name_<TComponent>();
 
         if (this->entity_registry_.try_ctx<TComponent>() != nullptr) {
-            (*this->lua_state_)["entity_registry"]["ctx_" + final_name] = [](entt::registry &self) {
+            (*this->lua_state_)["entity_registry"]["ctx_" + final_name] = [this](entt::registry &self) {
+                this->bind_type_<TComponent>();
                 return std::ref(self.ctx<TComponent>());
             };
         }
@@ -75,9 +74,10 @@ namespace antara::gaming::lua {
             return self.remove<TComponent>(entity);
         };
 
-        (*this->lua_state_)["entity_registry"]["get_"s + final_name + "_component"s] = [](
+        (*this->lua_state_)["entity_registry"]["get_"s + final_name + "_component"s] = [this](
                 entt::registry &self,
                 entt::registry::entity_type entity) {
+            this->bind_type_<TComponent>();
             if constexpr (not std::is_empty_v<TComponent>) {
                 return std::ref(self.get<TComponent>(entity));
             }
@@ -92,9 +92,10 @@ namespace antara::gaming::lua {
         };
 
         if constexpr (std::is_default_constructible_v<TComponent>) {
-            (*this->lua_state_)["entity_registry"]["add_"s + final_name + "_component"s] = [](
+            (*this->lua_state_)["entity_registry"]["add_"s + final_name + "_component"s] = [this](
                     entt::registry &self,
                     entt::registry::entity_type entity) {
+                this->bind_type_<TComponent>();
                 if constexpr (std::is_empty_v<TComponent>) {
                     self.assign<TComponent>(entity);
                 } else
@@ -52,4 +52,53 @@ namespace antara::gaming::lua {
             apply_functor(final_table);
         }
     }
-}
\ No newline at end of file
+
+    template<typename TypeToRegister>
+    std::string scripting_system::short_name_() noexcept {
+        std::string name = refl::reflect<TypeToRegister>().name.str();
+        if (std::size_t found = name.find_last_of(':'); found != std::string::npos) {
+            name = name.substr(found + 1);
+        }
+        return name;
+    }
+
+    template<typename TypeToRegister>
+    void scripting_system::register_type_lazily_() noexcept {
+        if (const auto id = ecs::component_id_of<TypeToRegister>(); id < bound_types_.size() && bound_types_[id]) {
+            return;
+        }
+        lazy_bindings_[short_name_<TypeToRegister>()] = [this]() {
+            this->bind_type_<TypeToRegister>();
+        };
+    }
+
+    /**
+     * Registers the usertype if it is not registered yet.
+     * Called when a script reads the global of the type, and before a value of the type is pushed to lua,
+     * since a value pushed before its usertype would miss its fields.
+     */
+    template<typename TypeToRegister>
+    void scripting_system::bind_type_() noexcept {
+        const auto id = ecs::component_id_of<TypeToRegister>();
+        if (id < bound_types_.size() && bound_types_[id]) {
+            return;
+        }
+        if (bound_types_.size() <= id) {
+            bound_types_.resize(id + 1u, false);
+        }
+        bound_types_[id] = true;
+        lazy_bindings_.erase(short_name_<TypeToRegister>());
+
+        //! fields of a registered type are reachable without going through their global, bind them first
+        refl::util::for_each(refl::reflect<TypeToRegister>().members, [this](auto member) {
+            if constexpr (refl::trait::is_field_v<decltype(member)>) {
+                using field_t = std::remove_cv_t<std::remove_reference_t<decltype(member(
+                        std::declval<TypeToRegister &>()))>>;
+                if constexpr (std::is_class_v<field_t> && refl::trait::is_reflectable_v<field_t>) {
+                    this->resolve_lazy_binding_(short_name_<field_t>());
+                }
+            }
+        });
+        this->register_type<TypeToRegister>();
+    }
+}
@@ -0,0 +1,33 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <array>
+#include <doctest/doctest.h>
+#include "antara/gaming/math/batch.hpp"
+
+namespace antara::gaming::math::tests
+{
+    TEST_CASE("lerp_n")
+    {
+        std::array<float, 5> previous{0.f, 10.f, -4.f, 2.f, 8.f};
+        std::array<float, 5> current{10.f, 10.f, 4.f, 4.f, 0.f};
+        std::array<float, 5> output{};
+        lerp_n(previous.data(), current.data(), output.data(), output.size(), 0.5f);
+        CHECK_EQ(output, std::array<float, 5>{5.f, 10.f, 0.f, 3.f, 4.f});
+        lerp_n(previous.data(), current.data(), output.data(), output.size(), 1.f);
+        CHECK_EQ(output, current);
+    }
+}
@@ -0,0 +1,45 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+
+#if defined(_OPENMP)
+#define ANTARA_SIMD_LOOP _Pragma("omp simd")
+#else
+#define ANTARA_SIMD_LOOP
+#endif
+
+namespace antara::gaming::math {
+    /**
+     * @brief lerp count floats from previous toward current into output, in a single branchless pass.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The arrays are expected to be contiguous and not to overlap with output, so the loop vectorize
+     *         (OpenMP simd when available, auto-vectorization otherwise).
+     * @endverbatim
+     */
+    inline void lerp_n(const float *__restrict previous, const float *__restrict current, float *__restrict output,
+                       std::size_t count, float interpolation) noexcept {
+        ANTARA_SIMD_LOOP
+        for (std::size_t i = 0; i < count; ++i) {
+            output[i] = previous[i] + (current[i] - previous[i]) * interpolation;
+        }
+    }
+}
@@ -72,6 +72,12 @@ namespace antara::gaming::resources
             return underlying_resource_manager_.load_music(id);
         }
 
+        template <typename ... Args>
+        auto build_texture_atlas(Args&& ...args)
+        {
+            return underlying_resource_manager_.build_texture_atlas(std::forward<Args>(args)...);
+        }
+
     private:
         UnderlyingResourceManager underlying_resource_manager_;
     };
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <optional>
 #include <utility>
 #include <SFML/Graphics.hpp>
 #include "meta/sequence/list.hpp"
+#include "antara/gaming/sfml/resources.loader.hpp"
 
 namespace antara::gaming::sfml
 {
@@ -28,6 +30,7 @@ namespace antara::gaming::sfml
         sprite() = default;
 
         sf::Sprite drawable;
+        texture_handle texture; ///< keeps the texture alive while a copy of the drawable waits for the render thread
     };
 
     struct rectangle
@@ -57,6 +60,8 @@ namespace antara::gaming::sfml
         text() = default;
 
         sf::Text drawable;
+        font_handle font; ///< keeps the font alive while a copy of the drawable waits for the render thread
+        std::optional<sf::FloatRect> global_bounds; ///< cached on construct/replace, culling must not load glyphs on the logic thread
     };
 
     struct vertex_array
@@ -14,7 +14,12 @@
  *                                                                            *
  ******************************************************************************/
 
+#include <chrono>
+#include <cstdint>
+#include <sstream>
 #include <type_traits>
+#include <utility>
+#include <loguru.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/zip.hpp>
 
@@ -28,6 +33,7 @@
 #include <antara/gaming/event/key.pressed.hpp>
 #include <antara/gaming/ecs/interpolation.system.hpp>
 #include <antara/gaming/event/fill.image.properties.hpp>
+#include <antara/gaming/timer/startup.trace.hpp>
 #include <antara/gaming/timer/time.step.hpp>
 #include "antara/gaming/graphics/component.2d.render.texture.hpp"
 #include "antara/gaming/config/config.game.maker.hpp"
@@ -56,6 +62,137 @@ namespace {
         global_bounds.pos = math::vec2f{g_left, g_top};
     }
 
+    template<typename TSFMLEntity>
+    void draw_debug_shapes(sf::RenderTarget &target, const TSFMLEntity &underlying_entity) {
+        auto[capsule_left, capsule_top, capsule_width, capsule_height] = underlying_entity.getGlobalBounds();
+        auto[_, __, width, height] = underlying_entity.getLocalBounds();
+
+        sf::RectangleShape shape_debug{sf::Vector2f(width, height)};
+        sf::RectangleShape aabb_shape_debug{sf::Vector2f(capsule_width, capsule_height)};
+
+        // Set origin for the new size as middle
+        shape_debug.setOrigin(width * 0.5f, height * 0.5f);
+
+        // Move to the middle of the encapsulating bounds
+        shape_debug.setPosition(capsule_left + capsule_width * 0.5f,
+                                capsule_top + capsule_height * 0.5f);
+        aabb_shape_debug.setPosition(capsule_left, capsule_top);
+
+        // Change the scale
+        shape_debug.setScale(underlying_entity.getScale());
+
+        // Rotate
+        shape_debug.setRotation(underlying_entity.getRotation());
+
+        // Cosmetic
+        shape_debug.setFillColor(sf::Color(0, 0, 0, 0));
+        shape_debug.setOutlineThickness(3.0f);
+        shape_debug.setOutlineColor(sf::Color::Red);
+
+        aabb_shape_debug.setFillColor(sf::Color(0, 0, 0, 0));
+        aabb_shape_debug.setOutlineThickness(3.0f);
+        aabb_shape_debug.setOutlineColor(sf::Color::Blue);
+
+        target.draw(shape_debug);
+        target.draw(aabb_shape_debug);
+    }
+
+    using render_clock = std::chrono::steady_clock;
+
+    float elapsed_ms(render_clock::time_point since) noexcept {
+        return std::chrono::duration<float, std::milli>(render_clock::now() - since).count();
+    }
+
+    std::size_t vertex_count(const sf::Sprite &) noexcept {
+        return 4u;
+    }
+
+    std::size_t vertex_count(const sf::Shape &shape) noexcept {
+        //! triangle fan of the fill, plus the triangle strip of the outline
+        std::size_t nb_points = shape.getPointCount();
+        return nb_points + 2u + (shape.getOutlineThickness() != 0.f ? (nb_points + 1u) * 2u : 0u);
+    }
+
+    std::size_t vertex_count(const sf::Text &text) noexcept {
+        return text.getString().getSize() * 6u;
+    }
+
+    std::size_t vertex_count(const sf::VertexArray &vertices) noexcept {
+        return vertices.getVertexCount();
+    }
+
+    const sf::Texture *texture_of(const sf::Sprite &sprite) noexcept {
+        return sprite.getTexture();
+    }
+
+    const sf::Texture *texture_of(const sf::Shape &shape) noexcept {
+        return shape.getTexture();
+    }
+
+    const sf::Texture *texture_of(const sf::Text &text) noexcept {
+        auto font = text.getFont();
+        return font != nullptr ? &font->getTexture(text.getCharacterSize()) : nullptr;
+    }
+
+    const sf::Texture *texture_of(const sf::VertexArray &) noexcept {
+        return nullptr;
+    }
+
+    void count_draw(graphics::render_stats &stats, const sf::Texture *&last_texture, const sf::Texture *texture,
+                    std::size_t nb_vertices) noexcept {
+        ++stats.draw_calls;
+        stats.vertices += nb_vertices;
+        if (texture != last_texture) {
+            ++stats.texture_switches;
+            last_texture = texture;
+        }
+    }
+
+    template<typename SFMLDrawable>
+    void count_draw(graphics::render_stats &stats, const sf::Texture *&last_texture,
+                    const SFMLDrawable &drawable, const sf::Texture *texture = nullptr) noexcept {
+        count_draw(stats, last_texture, texture != nullptr ? texture : texture_of(drawable), vertex_count(drawable));
+    }
+
+    std::string stats_str(const graphics::render_stats &stats) {
+        std::ostringstream ss;
+        ss << "draw calls: " << stats.draw_calls << " vertices: " << stats.vertices
+           << " texture switches: " << stats.texture_switches << "\n"
+           << "render texture clears: " << stats.render_texture_clears << " culled: " << stats.culled_entities << "\n"
+           << "draw: " << stats.draw_time_ms << " ms display: " << stats.display_time_ms << " ms";
+        return ss.str();
+    }
+
+    template<typename... DrawableType>
+    constexpr auto indexes_of(doom::meta::list<DrawableType...>) noexcept {
+        return std::index_sequence_for<DrawableType...>{};
+    }
+
+    //! Drawables sharing a texture get the same key bits, a collision only costs a texture switch
+    std::uint32_t texture_key(const sf::Texture *texture) noexcept {
+        return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(texture) >> 4u);
+    }
+
+    template<typename DrawableType>
+    std::uint32_t texture_key(const DrawableType &drawable) noexcept {
+        if constexpr (std::is_same_v<DrawableType, sfml::sprite> || std::is_same_v<DrawableType, sfml::circle> ||
+                      std::is_same_v<DrawableType, sfml::rectangle>) {
+            return texture_key(drawable.drawable.getTexture());
+        } else {
+            return 0u;
+        }
+    }
+
+    //! Texts are culled on their cached bounds (kept when unknown), the other drawables have no side effects
+    template<typename DrawableType>
+    bool is_outside(const sf::FloatRect &cull_rect, const DrawableType &cmp) noexcept {
+        if constexpr (std::is_same_v<DrawableType, sfml::text>) {
+            return cmp.global_bounds.has_value() && not cull_rect.intersects(cmp.global_bounds.value());
+        } else {
+            return not cull_rect.intersects(cmp.drawable.getGlobalBounds());
+        }
+    }
+
     template<typename TSFMLEntity>
     void fill_properties_sfml_entity(entt::registry &registry, entt::entity entity,
                                      TSFMLEntity &underlying_entity) noexcept {
@@ -93,7 +230,19 @@ namespace antara::gaming::sfml {
         registry.on_replace<geometry::circle>().connect<&graphic_system::on_circle_construct>(*this);
         registry.on_construct<geometry::rectangle>().connect<&graphic_system::on_rectangle_construct>(*this);
         registry.on_replace<geometry::rectangle>().connect<&graphic_system::on_rectangle_construct>(*this);
-        refresh_render_texture();
+        {
+            auto trace_scope = timer::startup_trace::shared().measure("render textures", get_name());
+            refresh_render_texture();
+        }
+        if (canvas_2d.threaded_rendering) {
+#if defined(IMGUI_AND_SFML_ENABLED)
+            VLOG_F(loguru::Verbosity_WARNING, "threaded rendering is not supported with imgui, using the synchronous renderer");
+#else
+            threaded_rendering_ = true;
+            this->entity_registry_.set<ecs::render_snapshot_buffer>();
+            start_render_thread_();
+#endif
+        }
     }
 
     void graphic_system::refresh_render_texture() noexcept {
@@ -117,119 +266,329 @@ namespace antara::gaming::sfml {
     }
 
     void graphic_system::update() noexcept {
+        if (threaded_rendering_) {
+            //! render textures are drawn straight from the registry, park the render thread while one exists
+            const bool has_render_textures = not this->entity_registry_.view<sfml::render_texture>().empty();
+            if (has_render_textures && render_thread_.joinable()) {
+                DVLOG_F(loguru::Verbosity_INFO, "render textures in use, falling back to the synchronous renderer");
+                stop_render_thread_();
+            } else if (not has_render_textures && not render_thread_.joinable()) {
+                start_render_thread_();
+            }
+            if (not has_render_textures) {
+                submit_render_frame_();
+                return;
+            }
+        }
+        render_stats_.reset_counters();
+        last_texture_ = nullptr;
         window_.clear();
         render_texture_.clear();
+        ++render_stats_.render_texture_clears;
+        auto draw_start = render_clock::now();
         draw_all_layers();
+        render_stats_.draw_time_ms = elapsed_ms(draw_start);
+        auto display_start = render_clock::now();
         render_texture_.display();
         window_.draw(render_texture_sprite_);
         if (this->debug_mode_) {
-            sf::Text fps_text;
-            auto &resources_system = this->entity_registry_.ctx<sfml::resources_system>();
-            auto handle = resources_system.load_font("sansation.ttf");
-            fps_text.setString(antara::gaming::timer::time_step::fps_str_);
-            fps_text.setFont(handle.get());
-            window_.draw(fps_text);
+            draw_debug_overlay_(fps_str_(), render_stats_);
         }
 #if defined(IMGUI_AND_SFML_ENABLED)
         ImGui::SFML::Render(window_);
 #endif
         window_.display();
+        render_stats_.display_time_ms = elapsed_ms(display_start);
     }
 
     sf::RenderWindow &graphic_system::get_window() noexcept {
         return window_;
     }
 
-    template<size_t Layer, typename DrawableType>
-    void graphic_system::draw() noexcept {
-        auto draw_functor = [this](entt::entity entity, auto &&drawable) {
-            if constexpr (doom::meta::is_detected_v<have_global_bounds, DrawableType>)
-                if (this->debug_mode_)
-                    draw_debug(drawable);
-
-            auto is_dynamic = this->entity_registry_.has<entt::tag<"dynamic"_hs>>(entity);
-            if (is_dynamic)
-                draw_dynamic_entities(entity, drawable);
-            else {
-                if constexpr (std::is_same_v<DrawableType, vertex_array>) {
-                    draw_vertices(entity, drawable);
-                } else if constexpr (std::is_same_v<DrawableType, render_texture>) {
-                    draw_render_texture(entity, drawable);
-                } else
-                    this->render_texture_.draw(drawable.drawable);
+    void graphic_system::draw_debug_overlay_(const std::string &fps_str, const graphics::render_stats &stats) noexcept {
+        if (debug_font_ == nullptr) {
+            return;
+        }
+        sf::Text fps_text;
+        fps_text.setString(fps_str);
+        fps_text.setFont(*debug_font_);
+        window_.draw(fps_text);
+
+        sf::Text stats_text;
+        stats_text.setString(stats_str(stats));
+        stats_text.setFont(*debug_font_);
+        stats_text.setCharacterSize(16u);
+        stats_text.setPosition(0.f, fps_text.getGlobalBounds().top + fps_text.getGlobalBounds().height + 8.f);
+        window_.draw(stats_text);
+    }
+
+    void graphic_system::start_render_thread_() noexcept {
+        //! The window context can only be active in one thread at a time
+        window_.setActive(false);
+        render_thread_running_ = true;
+        render_thread_ = std::thread(&graphic_system::render_thread_loop_, this);
+    }
+
+    void graphic_system::stop_render_thread_() noexcept {
+        if (not render_thread_.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(render_mutex_);
+            render_thread_running_ = false;
+            frame_ready_ = false;
+        }
+        render_cv_.notify_one();
+        render_thread_.join();
+        window_.setActive(true);
+    }
+
+    void graphic_system::render_thread_loop_() noexcept {
+        window_.setActive(true);
+        render_frame frame;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(render_mutex_);
+                render_cv_.wait(lock, [this]() { return frame_ready_ || not render_thread_running_; });
+                if (not render_thread_running_) {
+                    break;
+                }
+                std::swap(frame, pending_frame_);
+                frame_ready_ = false;
+            }
+            draw_render_frame_(frame);
+        }
+        window_.setActive(false);
+    }
+
+    void graphic_system::submit_render_frame_() noexcept {
+        auto &buffer = this->entity_registry_.ctx<ecs::render_snapshot_buffer>();
+        if (not buffer.try_acquire(snapshot_)) {
+            return;
+        }
+
+        building_frame_.commands.clear();
+        building_frame_.debug_mode = debug_mode_;
+        if (debug_mode_) {
+            building_frame_.fps_str = fps_str_();
+            building_frame_.stats = render_stats_;
+        }
+        update_cull_rect_();
+        render_stats_.culled_entities = 0u;
+        render_queue_.clear();
+        queued_commands_.clear();
+        for (auto &&entry : snapshot_.entries) {
+            push_render_command_(entry, drawable_list{}, indexes_of(drawable_list{}));
+        }
+        render_queue_.sort();
+        for (auto &&item : render_queue_.items()) {
+            building_frame_.commands.push_back(std::move(queued_commands_[item.index]));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(render_mutex_);
+            std::swap(building_frame_, pending_frame_);
+            frame_ready_ = true;
+            //! draw counters and timings come from the last frame drawn by the render thread
+            auto nb_culled = render_stats_.culled_entities;
+            render_stats_ = render_thread_stats_;
+            render_stats_.culled_entities = nb_culled;
+        }
+        render_cv_.notify_one();
+    }
+
+    template<typename... DrawableType, std::size_t... Is>
+    void graphic_system::push_render_command_(const ecs::render_snapshot::entry &entry,
+                                              doom::meta::list<DrawableType...>, std::index_sequence<Is...>) noexcept {
+        (push_render_command_<Is, DrawableType>(entry), ...);
+    }
+
+    template<std::size_t TypeIndex, typename DrawableType>
+    void graphic_system::push_render_command_(const ecs::render_snapshot::entry &entry) noexcept {
+        auto cmp = this->entity_registry_.try_get<DrawableType>(entry.entity);
+        if (cmp == nullptr) {
+            return;
+        }
+        const auto layer = static_cast<std::uint32_t>(entry.layer);
+        if constexpr (std::is_same_v<DrawableType, render_texture>) {
+            //! never reached, update() switches to the synchronous renderer while a render texture exists
+            return;
+        } else if constexpr (std::is_same_v<DrawableType, vertex_array>) {
+            auto &vertices = this->entity_registry_.get<geometry::vertex_array>(entry.entity);
+            render_command cmd{cmp->drawable, nullptr};
+            if (vertices.texture_id.has_value()) {
+                auto &res_system = this->entity_registry_.ctx<resources_system>();
+                cmd.pinned_texture = res_system.load_texture(vertices.texture_id.value().c_str());
+                cmd.texture = &cmd.pinned_texture.get();
+            } else if (vertices.entity_that_own_render_texture.has_value()) {
+                return;
             }
-        };
+            render_queue_.push(graphics::render_queue::make_key(layer, entry.depth, texture_key(cmd.texture), TypeIndex));
+            queued_commands_.push_back(std::move(cmd));
+        } else {
+            if (not entry.is_dynamic && is_outside(cull_rect_, *cmp)) {
+                ++render_stats_.culled_entities;
+                return;
+            }
+            render_queue_.push(graphics::render_queue::make_key(layer, entry.depth, texture_key(*cmp), TypeIndex));
+            auto &cmd = queued_commands_.emplace_back(render_command{cmp->drawable, nullptr});
+            if constexpr (std::is_same_v<DrawableType, sprite>) {
+                cmd.pinned_texture = cmp->texture;
+            } else if constexpr (std::is_same_v<DrawableType, text>) {
+                cmd.pinned_font = cmp->font;
+            }
+            if (entry.is_dynamic) {
+                auto pos = entry.interpolated_position(snapshot_.interpolation);
+                std::get<std::decay_t<decltype(cmp->drawable)>>(cmd.drawable).setPosition(pos.x(), pos.y());
+            }
+        }
+    }
+
+    void graphic_system::draw_render_frame_(const render_frame &frame) noexcept {
+        graphics::render_stats stats;
+        const sf::Texture *last_texture = nullptr;
+        window_.clear();
+        render_texture_.clear();
+        ++stats.render_texture_clears;
+        auto draw_start = render_clock::now();
+        for (auto &&cmd : frame.commands) {
+            std::visit([this, &cmd, &frame, &stats, &last_texture](auto &&drawable) {
+                using drawable_type = std::decay_t<decltype(drawable)>;
+                std::unique_lock<std::mutex> glyph_lock(glyph_mutex_, std::defer_lock);
+                if constexpr (std::is_same_v<drawable_type, sf::Text>) {
+                    glyph_lock.lock();
+                }
+                if constexpr (not std::is_same_v<drawable_type, sf::VertexArray>) {
+                    if (frame.debug_mode) {
+                        draw_debug_shapes(render_texture_, drawable);
+                        stats.draw_calls += 2u;
+                    }
+                }
+                count_draw(stats, last_texture, drawable, cmd.texture);
+                render_texture_.draw(drawable, cmd.texture);
+            }, cmd.drawable);
+        }
+        stats.draw_time_ms = elapsed_ms(draw_start);
+        auto display_start = render_clock::now();
+        render_texture_.display();
+        window_.draw(render_texture_sprite_);
+        if (frame.debug_mode) {
+            draw_debug_overlay_(frame.fps_str, frame.stats);
+        }
+        window_.display();
+        stats.display_time_ms = elapsed_ms(display_start);
 
-        this->entity_registry_.view<DrawableType, graphics::layer<Layer>>().less(draw_functor);
+        std::lock_guard<std::mutex> lock(render_mutex_);
+        render_thread_stats_ = stats;
     }
 
-    template<typename Drawable>
-    void graphic_system::draw_vertices(entt::entity entity, Drawable &drawable) const {
+    std::string graphic_system::fps_str_() const noexcept {
+        const auto *time_step = entity_registry_.try_ctx<timer::time_step>();
+        return time_step != nullptr ? time_step->fps_str_ : std::string{};
+    }
+
+    void graphic_system::update_cull_rect_() noexcept {
+        const auto &view = render_texture_.getView();
+        cull_rect_ = sf::FloatRect(view.getCenter() - view.getSize() * 0.5f, view.getSize());
+    }
+
+    const sf::Texture *graphic_system::vertices_texture_(entt::entity entity) const noexcept {
         auto &vertices = entity_registry_.get<geometry::vertex_array>(entity);
         if (vertices.texture_id.has_value()) {
             auto &res_system = entity_registry_.ctx<resources_system>();
             auto handle = res_system.load_texture(vertices.texture_id.value().c_str());
-            render_texture_.draw(drawable.drawable, &handle.get());
-        } else if (vertices.entity_that_own_render_texture.has_value()) {
+            return &handle.get();
+        }
+        if (vertices.entity_that_own_render_texture.has_value()) {
             auto rt = entity_registry_.try_get<sfml::render_texture>(vertices.entity_that_own_render_texture.value());
             if (rt != nullptr) {
-                sf::RenderTexture &underlying_texture = *(rt->drawable);
-                render_texture_.draw(drawable.drawable, &underlying_texture.getTexture());
+                return &rt->drawable->getTexture();
             }
-        } else {
-            render_texture_.draw(drawable.drawable);
         }
+        return nullptr;
     }
 
-    template<typename Drawable>
-    void graphic_system::draw_debug(Drawable &drawable) const {
-        auto[capsule_left, capsule_top, capsule_width, capsule_height] = drawable.drawable.getGlobalBounds();
-        auto[_, __, width, height] = drawable.drawable.getLocalBounds();
-
-        sf::RectangleShape shape_debug{sf::Vector2f(width, height)};
-        sf::RectangleShape aabb_shape_debug{sf::Vector2f(capsule_width, capsule_height)};
-
-        // Set origin for the new size as middle
-        shape_debug.setOrigin(width * 0.5f, height * 0.5f);
+    template<std::size_t TypeIndex, typename DrawableType>
+    void graphic_system::fill_render_queue_() noexcept {
+        this->entity_registry_.view<DrawableType, graphics::draw_order>().each(
+                [this](entt::entity entity, DrawableType &drawable, graphics::draw_order &order) {
+                    render_queue_.push(graphics::render_queue::make_key(order.layer, order.depth,
+                                                                        texture_key(drawable), TypeIndex));
+                    queued_entities_.push_back(entity);
+                });
+    }
 
-        // Move to the middle of the encapsulating bounds
-        shape_debug.setPosition(capsule_left + capsule_width * 0.5f,
-                                capsule_top + capsule_height * 0.5f);
-        aabb_shape_debug.setPosition(capsule_left, capsule_top);
+    template<typename... DrawableType, std::size_t... Is>
+    void graphic_system::fill_render_queue_(doom::meta::list<DrawableType...>, std::index_sequence<Is...>) noexcept {
+        (fill_render_queue_<Is, DrawableType>(), ...);
+    }
 
-        // Change the scale
-        shape_debug.setScale(drawable.drawable.getScale());
+    template<typename DrawableType>
+    void graphic_system::draw_entity_(entt::entity entity) noexcept {
+        auto &drawable = this->entity_registry_.get<DrawableType>(entity);
+        auto is_dynamic = this->entity_registry_.has<entt::tag<"dynamic"_hs>>(entity);
+        if constexpr (doom::meta::is_detected_v<have_global_bounds, DrawableType>) {
+            //! dynamic entities are drawn at their interpolated position, they are never culled
+            if (not is_dynamic && not cull_rect_.intersects(drawable.drawable.getGlobalBounds())) {
+                ++render_stats_.culled_entities;
+                return;
+            }
+            if (this->debug_mode_)
+                draw_debug(drawable);
+        }
 
-        // Rotate
-        shape_debug.setRotation(drawable.drawable.getRotation());
+        if (is_dynamic)
+            draw_dynamic_entities(entity, drawable);
+        else {
+            if constexpr (std::is_same_v<DrawableType, vertex_array>) {
+                draw_vertices(entity, drawable);
+            } else if constexpr (std::is_same_v<DrawableType, render_texture>) {
+                draw_render_texture(entity, drawable);
+            } else {
+                count_draw(render_stats_, last_texture_, drawable.drawable);
+                this->render_texture_.draw(drawable.drawable);
+            }
+        }
+    }
 
-        // Cosmetic
-        shape_debug.setFillColor(sf::Color(0, 0, 0, 0));
-        shape_debug.setOutlineThickness(3.0f);
-        shape_debug.setOutlineColor(sf::Color::Red);
+    template<typename... DrawableType, std::size_t... Is>
+    void graphic_system::draw_entity_(entt::entity entity, std::uint32_t type, doom::meta::list<DrawableType...>,
+                                      std::index_sequence<Is...>) noexcept {
+        static_cast<void>(((type == Is ? (draw_entity_<DrawableType>(entity), true) : false) || ...));
+    }
 
-        aabb_shape_debug.setFillColor(sf::Color(0, 0, 0, 0));
-        aabb_shape_debug.setOutlineThickness(3.0f);
-        aabb_shape_debug.setOutlineColor(sf::Color::Blue);
+    template<typename Drawable>
+    void graphic_system::draw_vertices(entt::entity entity, Drawable &drawable) const {
+        auto &vertices = entity_registry_.get<geometry::vertex_array>(entity);
+        auto texture = vertices_texture_(entity);
+        if (texture == nullptr && vertices.entity_that_own_render_texture.has_value()) {
+            return;
+        }
+        count_draw(render_stats_, last_texture_, drawable.drawable, texture);
+        render_texture_.draw(drawable.drawable, texture);
+    }
 
-        render_texture_.draw(shape_debug);
-        render_texture_.draw(aabb_shape_debug);
+    template<typename Drawable>
+    void graphic_system::draw_debug(Drawable &drawable) const {
+        draw_debug_shapes(render_texture_, drawable.drawable);
+        render_stats_.draw_calls += 2u;
     }
 
     template<typename Drawable>
     void graphic_system::draw_dynamic_entities(entt::entity entity, Drawable &drawable) const {
         if constexpr (doom::meta::is_detected_v<have_set_position, Drawable>) {
-            auto org_pos = entity_registry_.get<transform::position_2d>(entity); //! save org
-            auto prev_pos = entity_registry_.get<transform::previous_position_2d>(entity); //! save org
-            if (prev_pos != org_pos) {
-                float interp = entity_registry_.ctx<ecs::interpolation_system::st_interpolation>().value();
-                auto pos = prev_pos + (org_pos - prev_pos) * interp;
-                drawable.drawable.setPosition(pos.x(), pos.y());
-                render_texture_.draw(drawable.drawable);
-                drawable.drawable.setPosition(org_pos.x(), org_pos.y());
-            } else {
+            //! interpolated by ecs::interpolation_system::interpolate, drawn through a translation instead of moving the drawable
+            auto interpolated_pos = entity_registry_.try_get<transform::interpolated_position_2d>(entity);
+            if (interpolated_pos == nullptr) {
+                count_draw(render_stats_, last_texture_, drawable.drawable);
                 render_texture_.draw(drawable.drawable);
+                return;
             }
+            auto org_pos = drawable.drawable.getPosition();
+            sf::Transform transform;
+            transform.translate(interpolated_pos->x() - org_pos.x, interpolated_pos->y() - org_pos.y);
+            count_draw(render_stats_, last_texture_, drawable.drawable);
+            render_texture_.draw(drawable.drawable, transform);
         }
     }
 
@@ -239,6 +598,7 @@ namespace antara::gaming::sfml {
         auto[r, g, b, a] = rt.clear_color;
         sf::RenderTexture &rt_underlying = *drawable.drawable;
         rt_underlying.clear(sf::Color(r, g, b, a));
+        ++render_stats_.render_texture_clears;
         for (auto&&[_, current_drawable] : rt.to_draw) {
             switch (current_drawable.dt) {
                 case graphics::d_vertex_array: {
@@ -247,25 +607,30 @@ namespace antara::gaming::sfml {
                     if (vertices.texture_id.has_value()) {
                         auto &res_system = entity_registry_.ctx<resources_system>();
                         auto handle = res_system.load_texture(vertices.texture_id.value().c_str());
+                        count_draw(render_stats_, last_texture_, sfml_vertices, &handle.get());
                         rt_underlying.draw(sfml_vertices, &handle.get());
                     } else {
+                        count_draw(render_stats_, last_texture_, sfml_vertices);
                         rt_underlying.draw(sfml_vertices);
                     }
                     break;
                 }
                 case graphics::d_sprite: {
                     auto &sfml_sprite = entity_registry_.get<sprite>(current_drawable.entity).drawable;
+                    count_draw(render_stats_, last_texture_, sfml_sprite);
                     rt_underlying.draw(sfml_sprite);
                     break;
                 }
                 case graphics::d_circle: {
                     auto &sfml_circle = entity_registry_.get<circle>(current_drawable.entity).drawable;
+                    count_draw(render_stats_, last_texture_, sfml_circle);
                     rt_underlying.draw(sfml_circle);
                     break;
                 }
                 case graphics::d_rectangle: {
                     auto &sfml_rectangle = entity_registry_.get<rectangle>(
                             current_drawable.entity).drawable;
+                    count_draw(render_stats_, last_texture_, sfml_rectangle);
                     rt_underlying.draw(sfml_rectangle);
                     break;
                 }
@@ -274,22 +639,27 @@ namespace antara::gaming::sfml {
         rt_underlying.display();
     }
 
-    template<size_t Layer, typename... DrawableType>
-    void graphic_system::draw(doom::meta::list<DrawableType...>) noexcept {
-        (draw<Layer, DrawableType>(), ...);
-    }
-
-    template<size_t... Is>
-    void graphic_system::draw_all_layers(std::index_sequence<Is...>) noexcept {
-        (draw<Is>(drawable_list{}), ...);
-    }
-
     void graphic_system::draw_all_layers() noexcept {
-        draw_all_layers(std::make_index_sequence<graphics::max_layer>{});
+        constexpr auto drawable_indexes = indexes_of(drawable_list{});
+        update_cull_rect_();
+        render_queue_.clear();
+        queued_entities_.clear();
+        fill_render_queue_(drawable_list{}, drawable_indexes);
+        render_queue_.sort();
+        for (auto &&item : render_queue_.items()) {
+            draw_entity_(queued_entities_[item.index], graphics::render_queue::type_of(item.key), drawable_list{},
+                         drawable_indexes);
+        }
     }
 
     void graphic_system::on_window_resized_event(const event::window_resized &) noexcept {
-        refresh_render_texture();
+        if (render_thread_.joinable()) {
+            stop_render_thread_();
+            refresh_render_texture();
+            start_render_thread_();
+        } else {
+            refresh_render_texture();
+        }
         this->dispatcher_.trigger<event::canvas_resized>();
     }
 
@@ -394,8 +764,15 @@ namespace antara::gaming::sfml {
     template<typename DrawableType>
     bool graphic_system::set_position(entt::entity entity, transform::position_2d &pos) noexcept {
         if (auto cmp = this->entity_registry_.try_get<DrawableType>(entity); cmp != nullptr) {
+            std::unique_lock<std::mutex> glyph_lock(glyph_mutex_, std::defer_lock);
+            if constexpr (std::is_same_v<DrawableType, text>) {
+                glyph_lock.lock();
+            }
             cmp->drawable.setPosition(pos.x(), pos.y());
             fill_properties_sfml_entity(entity_registry_, entity, cmp->drawable);
+            if constexpr (std::is_same_v<DrawableType, text>) {
+                cmp->global_bounds = cmp->drawable.getGlobalBounds();
+            }
             return true;
         }
         return false;
@@ -405,8 +782,11 @@ namespace antara::gaming::sfml {
     graphic_system::on_text_construct(entt::entity entity, entt::registry &registry, graphics::text &text) noexcept {
         auto &resources_system = this->entity_registry_.ctx<sfml::resources_system>();
         auto handle = resources_system.load_font(text.appearance);
-        sf::Text &sf_text = registry.assign_or_replace<sfml::text>(entity, sf::Text(text.contents, handle.get(),
-                                                                                    text.character_size)).drawable;
+        //! the render thread may be drawing a copy sharing this font, glyph loading must not overlap
+        std::lock_guard<std::mutex> glyph_lock(glyph_mutex_);
+        auto &sfml_text = registry.assign_or_replace<sfml::text>(entity, sf::Text(text.contents, handle.get(),
+                                                                                  text.character_size), handle);
+        sf::Text &sf_text = sfml_text.drawable;
 
         sf_text.setLineSpacing(text.spacing_lines);
         sf_text.setLetterSpacing(text.spacing_letters);
@@ -440,6 +820,7 @@ namespace antara::gaming::sfml {
         }
 
         fill_properties_sfml_entity(entity_registry_, entity, sf_text);
+        sfml_text.global_bounds = sf_text.getGlobalBounds();
     }
 
     void graphic_system::on_rt_construct(entt::entity entity, entt::registry &registry,
@@ -453,10 +834,18 @@ namespace antara::gaming::sfml {
     void
     graphic_system::on_sprite_construct(entt::entity entity, entt::registry &registry, graphics::sprite &spr) noexcept {
         auto &resources_system = this->entity_registry_.ctx<sfml::resources_system>();
-        auto handle = resources_system.load_texture(spr.appearance.c_str());
-        sf::Sprite &native_sprite = registry.assign_or_replace<sfml::sprite>(entity, sf::Sprite(handle.get())).drawable;
-
-        if (not spr.native_size) {
+        auto atlas = registry.try_ctx<graphics::texture_atlas>();
+        auto region = atlas != nullptr ? atlas->find(spr.appearance) : nullptr;
+        auto handle = region != nullptr ? resources_system.load_texture(atlas->pages[region->page].c_str())
+                                        : resources_system.load_texture(spr.appearance.c_str());
+        sf::Sprite &native_sprite = registry.assign_or_replace<sfml::sprite>(entity, sf::Sprite(handle.get()),
+                                                                             handle).drawable;
+
+        if (region != nullptr) {
+            //! texture_rec stays expressed in the original texture, the atlas moves it into its page
+            auto[pos, size] = graphics::texture_atlas::remap(*region, spr);
+            native_sprite.setTextureRect(sf::IntRect(pos.x(), pos.y(), size.x(), size.y()));
+        } else if (not spr.native_size) {
             auto[left, top] = spr.texture_rec.pos;
             auto[width, height] = spr.texture_rec.size;
             native_sprite.setTextureRect(sf::IntRect(left, top, width, height));
@@ -479,6 +868,10 @@ namespace antara::gaming::sfml {
     void graphic_system::on_key_pressed(const event::key_pressed &evt) noexcept {
         if (evt.key == input::key::f4) {
             debug_mode_ = !debug_mode_;
+            if (debug_mode_ && debug_font_ == nullptr) {
+                auto &resources_system = this->entity_registry_.ctx<sfml::resources_system>();
+                debug_font_ = &resources_system.load_font("sansation.ttf").get();
+            }
         }
     }
 
@@ -496,13 +889,27 @@ namespace antara::gaming::sfml {
     template<typename DrawableType>
     bool graphic_system::set_properties(entt::entity entity, transform::properties &props) noexcept {
         if (auto cmp = this->entity_registry_.try_get<DrawableType>(entity); cmp != nullptr) {
+            std::unique_lock<std::mutex> glyph_lock(glyph_mutex_, std::defer_lock);
+            if constexpr (std::is_same_v<DrawableType, text>) {
+                glyph_lock.lock();
+            }
             fill_properties(&props, cmp->drawable);
+            if constexpr (std::is_same_v<DrawableType, text>) {
+                cmp->global_bounds = cmp->drawable.getGlobalBounds();
+            }
             return true;
         }
         return false;
     }
 
     void graphic_system::on_fill_image_properties(const event::fill_image_properties &evt) noexcept {
+        if (auto atlas = this->entity_registry_.try_ctx<graphics::texture_atlas>(); atlas != nullptr) {
+            if (auto region = atlas->find(evt.appearance); region != nullptr) {
+                auto[width, height] = region->area.size;
+                evt.image_size.set_xy(static_cast<unsigned>(width), static_cast<unsigned>(height));
+                return;
+            }
+        }
         auto &resources_system = this->entity_registry_.ctx<sfml::resources_system>();
         auto handle = resources_system.load_texture(evt.appearance.c_str());
         auto[width, height] = handle->getSize();
@@ -510,6 +917,7 @@ namespace antara::gaming::sfml {
     }
 
     graphic_system::~graphic_system() noexcept {
+        stop_render_thread_();
 #if defined(IMGUI_AND_SFML_ENABLED)
         ImGui::SFML::Shutdown();
 #endif
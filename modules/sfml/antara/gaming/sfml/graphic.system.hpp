@@ -16,6 +16,14 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
 #include <entt/entity/helper.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
@@ -28,12 +36,16 @@
 #include "antara/gaming/graphics/component.canvas.hpp"
 #include "antara/gaming/graphics/component.text.hpp"
 #include "antara/gaming/graphics/component.sprite.hpp"
+#include "antara/gaming/graphics/component.render.stats.hpp"
+#include "antara/gaming/graphics/render.queue.hpp"
 #include "antara/gaming/event/key.pressed.hpp"
 #include "antara/gaming/event/window.resized.hpp"
 #include "antara/gaming/geometry/component.circle.hpp"
 #include "antara/gaming/geometry/component.rectangle.hpp"
 #include "antara/gaming/core/safe.refl.hpp"
+#include "antara/gaming/ecs/render.snapshot.hpp"
 #include "antara/gaming/ecs/system.hpp"
+#include "antara/gaming/sfml/resources.loader.hpp"
 
 namespace antara::gaming::sfml {
     template<typename T>
@@ -42,6 +54,22 @@ namespace antara::gaming::sfml {
     template<typename T>
     using have_set_position = decltype(std::declval<T &>().drawable.setPosition(std::declval<sf::Vector2f &>()));
 
+    //! Drawable copied out of the registry, owned by the render thread once submitted.
+    //! The copies keep raw texture/font pointers, the handles pin those resources until the frame is drawn.
+    struct render_command {
+        std::variant<sf::Sprite, sf::CircleShape, sf::Text, sf::VertexArray, sf::RectangleShape> drawable;
+        const sf::Texture *texture{nullptr};
+        texture_handle pinned_texture;
+        font_handle pinned_font;
+    };
+
+    struct render_frame {
+        std::vector<render_command> commands;
+        std::string fps_str;
+        graphics::render_stats stats;
+        bool debug_mode{false};
+    };
+
     class graphic_system final : public ecs::post_update_system<graphic_system> {
     public:
         graphic_system(entt::registry &registry) noexcept;
@@ -65,15 +93,7 @@ namespace antara::gaming::sfml {
         void
         set_properties(entt::entity entity, transform::properties &props, doom::meta::list<DrawableType...>) noexcept;
 
-        template<size_t Layer, typename DrawableType>
-        void draw() noexcept;
-
-        template<size_t Layer, typename... DrawableType>
-        void draw(doom::meta::list<DrawableType...>) noexcept;
-
-        template<size_t...Is>
-        void draw_all_layers(std::index_sequence<Is...>) noexcept;
-
+        //! Fill the render queue from every drawable with a graphics::draw_order, sort it and draw it.
         void draw_all_layers() noexcept;
 
         //! Public getter
@@ -116,6 +136,64 @@ namespace antara::gaming::sfml {
                                                                          : static_cast<sf::Uint32>(sf::Style::None)};
         sf::RenderTexture &render_texture_{this->entity_registry_.set<sf::RenderTexture>()};
         sf::Sprite &render_texture_sprite_{this->entity_registry_.set<sf::Sprite>()};
+        const sf::Font *debug_font_{nullptr};
+        graphics::render_stats &render_stats_{this->entity_registry_.set<graphics::render_stats>()};
+        mutable const sf::Texture *last_texture_{nullptr};
+        sf::FloatRect cull_rect_;
+        graphics::render_queue render_queue_;
+        std::vector<entt::entity> queued_entities_;
+        std::vector<render_command> queued_commands_;
+
+        //! Threaded rendering (canvas_2d::threaded_rendering), parked while a render texture exists
+        bool threaded_rendering_{false};
+        bool render_thread_running_{false};
+        bool frame_ready_{false};
+        ecs::render_snapshot snapshot_;
+        render_frame building_frame_;
+        render_frame pending_frame_;
+        std::mutex render_mutex_;
+        std::mutex glyph_mutex_; ///< sf::Font loads glyphs lazily, texts copies share their font with the originals
+        std::condition_variable render_cv_;
+        std::thread render_thread_;
+        graphics::render_stats render_thread_stats_;
+
+        void start_render_thread_() noexcept;
+
+        void stop_render_thread_() noexcept;
+
+        void render_thread_loop_() noexcept;
+
+        void submit_render_frame_() noexcept;
+
+        void draw_render_frame_(const render_frame &frame) noexcept;
+
+        void draw_debug_overlay_(const std::string &fps_str, const graphics::render_stats &stats) noexcept;
+
+        void update_cull_rect_() noexcept;
+
+        [[nodiscard]] std::string fps_str_() const noexcept;
+
+        template<std::size_t TypeIndex, typename DrawableType>
+        void push_render_command_(const ecs::render_snapshot::entry &entry) noexcept;
+
+        template<typename ... DrawableType, std::size_t... Is>
+        void push_render_command_(const ecs::render_snapshot::entry &entry, doom::meta::list<DrawableType...>,
+                                  std::index_sequence<Is...>) noexcept;
+
+        template<std::size_t TypeIndex, typename DrawableType>
+        void fill_render_queue_() noexcept;
+
+        template<typename ... DrawableType, std::size_t... Is>
+        void fill_render_queue_(doom::meta::list<DrawableType...>, std::index_sequence<Is...>) noexcept;
+
+        template<typename DrawableType>
+        void draw_entity_(entt::entity entity) noexcept;
+
+        template<typename ... DrawableType, std::size_t... Is>
+        void draw_entity_(entt::entity entity, std::uint32_t type, doom::meta::list<DrawableType...>,
+                          std::index_sequence<Is...>) noexcept;
+
+        [[nodiscard]] const sf::Texture *vertices_texture_(entt::entity entity) const noexcept;
 
         template<typename Drawable>
         void draw_render_texture(entt::entity entity, Drawable &drawable) const;
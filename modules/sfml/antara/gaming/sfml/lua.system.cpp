@@ -30,7 +30,7 @@ namespace antara::gaming::sfml
         auto text_functor = [this](const char* text, const char *font_id, unsigned int size = 30) {
             auto entity = this->entity_registry_.create();
             auto handle = this->resource_mgr_.load_font(font_id);
-            this->entity_registry_.assign<sfml::text>(entity, sf::Text(text, handle.get(), size));
+            this->entity_registry_.assign<sfml::text>(entity, sf::Text(text, handle.get(), size), handle);
             return entity;
         };
 
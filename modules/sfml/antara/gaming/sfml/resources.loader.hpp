@@ -18,6 +18,7 @@
 
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Font.hpp>
 #include <entt/resource/loader.hpp>
@@ -54,6 +55,19 @@ namespace antara::gaming::sfml
         }
     };
 
+    //! Build a texture from an image already in memory (atlas pages)
+    struct texture_from_image_loader final : entt::loader<texture_from_image_loader, sf::Texture>
+    {
+        std::shared_ptr<sf::Texture> load(const sf::Image &image) const
+        {
+            auto resource_ptr = std::make_shared<sf::Texture>();
+            if (not resource_ptr->loadFromImage(image)) {
+                throw std::runtime_error("Impossible to load image");
+            }
+            return resource_ptr;
+        }
+    };
+
     //! Public typedefs
     using textures_cache = entt::cache<sf::Texture>;
     using musics_cache = entt::cache<sf::Music>;
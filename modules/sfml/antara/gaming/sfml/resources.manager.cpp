@@ -14,6 +14,11 @@
  *                                                                            *
  ******************************************************************************/
 
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <loguru.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include "antara/gaming/sfml/resources.manager.hpp"
 
 namespace antara::gaming::sfml
@@ -44,4 +49,64 @@ namespace antara::gaming::sfml
         return resources_manager::load<musics_loader, musics_cache>(musics_cache_, resource_id,
                                                                     (musics_path_ / resource_id).string());
     }
-}
\ No newline at end of file
+
+    graphics::texture_atlas resources_manager::build_texture_atlas(math::vec2u page_size, unsigned max_texture_size)
+    {
+        LOG_SCOPE_FUNCTION(INFO);
+        struct atlas_source
+        {
+            std::string id;
+            sf::Image image;
+        };
+
+        std::vector<atlas_source> sources;
+        std::error_code ec;
+        for (auto &&entry : std::filesystem::recursive_directory_iterator(textures_path_, ec)) {
+            if (not entry.is_regular_file()) {
+                continue;
+            }
+            sf::Image image;
+            if (not image.loadFromFile(entry.path().string())) {
+                continue;
+            }
+            auto[width, height] = image.getSize();
+            if (width > max_texture_size || height > max_texture_size) {
+                continue;
+            }
+            sources.push_back(atlas_source{entry.path().lexically_relative(textures_path_).generic_string(),
+                                           std::move(image)});
+        }
+
+        //! tallest first keep the skyline flat
+        std::sort(sources.begin(), sources.end(), [](const atlas_source &lhs, const atlas_source &rhs) {
+            return lhs.image.getSize().y > rhs.image.getSize().y;
+        });
+
+        graphics::texture_atlas atlas;
+        graphics::atlas_packer packer{page_size};
+        std::vector<sf::Image> pages;
+        for (auto &&[id, image] : sources) {
+            auto[width, height] = image.getSize();
+            auto region = packer.insert(math::vec2u{width, height});
+            if (not region.has_value()) {
+                continue;
+            }
+            while (pages.size() < packer.nb_pages()) {
+                pages.emplace_back().create(page_size.x(), page_size.y(), sf::Color::Transparent);
+            }
+            auto[x, y] = region.value().area.pos;
+            pages[region.value().page].copy(image, static_cast<unsigned>(x), static_cast<unsigned>(y));
+            atlas.regions.emplace(id, region.value());
+        }
+
+        for (std::size_t idx = 0; idx < pages.size(); ++idx) {
+            auto page_id = "atlas_page_" + std::to_string(idx);
+            textures_cache_.load<texture_from_image_loader>(entt::hashed_string::to_value(page_id.c_str()),
+                                                           pages[idx]);
+            atlas.pages.push_back(std::move(page_id));
+        }
+        DVLOG_F(loguru::Verbosity_INFO, "{} textures packed in {} atlas pages", atlas.regions.size(),
+                atlas.pages.size());
+        return atlas;
+    }
+}
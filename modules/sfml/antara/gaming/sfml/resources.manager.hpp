@@ -20,6 +20,7 @@
 #include <utility>
 #include <entt/core/hashed_string.hpp>
 #include "antara/gaming/core/real.path.hpp"
+#include "antara/gaming/graphics/texture.atlas.hpp"
 #include "antara/gaming/resources/resources.system.hpp"
 #include "antara/gaming/sfml/resources.loader.hpp"
 
@@ -60,6 +61,15 @@ namespace antara::gaming::sfml
 
         music_handle load_music(const char* resource_id);
 
+        /**
+         * @brief pack the small textures of assets/textures into atlas pages loaded in the textures cache.
+         * @param page_size size of an atlas page
+         * @param max_texture_size textures with a side bigger than this value stay standalone
+         * @return the atlas to store in the registry context, sprites are then remapped by the graphic system
+         */
+        graphics::texture_atlas build_texture_atlas(math::vec2u page_size = math::vec2u{2048u, 2048u},
+                                                    unsigned max_texture_size = 256u);
+
     private:
         const std::filesystem::path assets_path_{antara::gaming::core::assets_real_path()};
         std::filesystem::path musics_path_{assets_path_ / "musics"};
@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+
+//! SDK Headers
+#include "antara/gaming/timer/frame.pacer.hpp" ///< frame_pacer
+
+namespace antara::gaming::timer::tests {
+    TEST_SUITE ("frame pacer tests") {
+        TEST_CASE ("frames are paced to the target frame time") {
+            frame_pacer pacer{5ms};
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < 11; ++i) {
+                pacer.wait_next_frame();
+            }
+                    CHECK_GE(std::chrono::steady_clock::now() - start, 50ms);
+                    CHECK_EQ(pacer.get_stats().nb_frames, 11u);
+                    CHECK_GE(pacer.get_stats().max_jitter, pacer.get_stats().mean_jitter);
+            pacer.reset_stats();
+                    CHECK_EQ(pacer.get_stats().nb_frames, 0u);
+        }
+
+        TEST_CASE ("no limit") {
+            frame_pacer pacer{0ns};
+            pacer.wait_next_frame();
+            pacer.wait_next_frame();
+                    CHECK_EQ(pacer.get_stats().nb_frames, 0u);
+        }
+
+        TEST_CASE ("idle mode") {
+            frame_pacer pacer{1ms};
+            pacer.enable_idle_mode(0ns, 2ms);
+            pacer.wait_next_frame();
+                    CHECK(pacer.is_idle());
+                    CHECK_EQ(pacer.get_frame_time(), 2ms);
+            pacer.notify_activity();
+                    CHECK_FALSE(pacer.is_idle());
+                    CHECK_EQ(pacer.get_frame_time(), 1ms);
+            pacer.disable_idle_mode();
+            pacer.wait_next_frame();
+                    CHECK_FALSE(pacer.is_idle());
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <sstream> ///< std::ostringstream
+
+//! Dependencies Headers
+#include <doctest/doctest.h>
+
+//! SDK Headers
+#include "antara/gaming/timer/frame.recorder.hpp" ///< frame_recorder
+
+namespace antara::gaming::timer::tests {
+    using namespace std::chrono_literals;
+
+    TEST_SUITE ("frame recorder tests") {
+        TEST_CASE ("log buckets") {
+                    CHECK_EQ(frame_histogram::bucket_of(0ns), 0u);
+                    CHECK_EQ(frame_histogram::bucket_of(15us), 15u);
+                    CHECK_EQ(frame_histogram::bucket_of(16us), 16u);
+                    CHECK_EQ(frame_histogram::bucket_of(17us), 16u);
+                    CHECK_EQ(frame_histogram::bucket_of(32us), 24u);
+                    CHECK_EQ(frame_histogram::bucket_of(10h), frame_histogram::nb_buckets - 1u);
+            for (std::chrono::nanoseconds duration : {1us, 20us, 1000us, 16000us, 33000us, 1000000us}) {
+                auto bucket = frame_histogram::bucket_of(duration);
+                        CHECK_GE(frame_histogram::upper_bound_of(bucket), duration);
+                        CHECK_LE(frame_histogram::upper_bound_of(bucket), duration + duration / 8 + 1us);
+            }
+        }
+
+        TEST_CASE ("percentiles") {
+            frame_recorder recorder;
+            for (int i = 1; i <= 100; ++i) {
+                recorder.record(std::chrono::milliseconds(i), 1u, 0ns);
+            }
+            auto pct = recorder.window_percentiles();
+                    CHECK_GE(pct.p50, 50ms);
+                    CHECK_LE(pct.p50, 57ms);
+                    CHECK_GE(pct.p95, 95ms);
+                    CHECK_LE(pct.p99, 100ms);
+                    CHECK_EQ(pct.max, 100ms);
+                    CHECK_EQ(recorder.total_percentiles().max, 100ms);
+                    CHECK_EQ(recorder.window_size(), 100u);
+        }
+
+        TEST_CASE ("rolling window") {
+            frame_recorder recorder;
+            recorder.record(1s, 4u, 2ms);
+            for (std::size_t i = 0; i < frame_recorder::window_capacity; ++i) {
+                recorder.record(1ms, 1u, 0ns);
+            }
+                    CHECK_EQ(recorder.window_size(), frame_recorder::window_capacity);
+                    CHECK_EQ(recorder.nb_frames(), frame_recorder::window_capacity + 1u);
+                    CHECK_EQ(recorder.window_percentiles().max, 1ms);
+                    CHECK_EQ(recorder.window_percentiles().p99, 1ms);
+                    CHECK_EQ(recorder.total_percentiles().max, 1s);
+                    CHECK_EQ(recorder.max_logic_ticks(), 1u);
+                    CHECK_EQ(recorder.max_lag(), 0ns);
+                    CHECK_EQ(recorder.mean_logic_ticks(), doctest::Approx(1.f));
+                    CHECK_EQ(recorder.total_max_lag(), 2ms);
+                    CHECK_EQ(recorder.total_mean_logic_ticks(),
+                             doctest::Approx((frame_recorder::window_capacity + 4.f) / (frame_recorder::window_capacity + 1.f)));
+            recorder.reset();
+                    CHECK_EQ(recorder.nb_frames(), 0u);
+                    CHECK_EQ(recorder.total_max_lag(), 0ns);
+                    CHECK_EQ(recorder.total_mean_logic_ticks(), doctest::Approx(0.f));
+                    CHECK_EQ(recorder.window_percentiles().p50, 0ns);
+        }
+
+        TEST_CASE ("csv export") {
+            frame_recorder recorder;
+            recorder.record(2ms, 2u, 500us);
+            std::ostringstream samples;
+            recorder.write_csv(samples);
+                    CHECK_EQ(samples.str(), "frame,frame_time_us,logic_ticks,lag_us\n0,2000,2,500\n");
+            std::ostringstream summary;
+            recorder.write_csv_summary(summary);
+                    CHECK_EQ(summary.str().rfind("scope,frames,p50_us,p95_us,p99_us,max_us,mean_logic_ticks,max_lag_us\n", 0), 0u);
+                    CHECK_NE(summary.str().find("\ntotal,1,2000,2000,2000,2000,2,500\n"), std::string::npos);
+        }
+    }
+}
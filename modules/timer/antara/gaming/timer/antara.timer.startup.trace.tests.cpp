@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <sstream>
+#include <thread>
+#include <doctest/doctest.h>
+
+//! SDK Headers
+#include "antara/gaming/timer/startup.trace.hpp" ///< startup_trace
+
+namespace antara::gaming::timer::tests {
+    TEST_SUITE ("startup trace tests") {
+        TEST_CASE ("steps are nested and timed") {
+            startup_trace trace;
+            trace.restart();
+            {
+                auto app = trace.measure("app");
+                {
+                    auto config = trace.measure("config loading", "game.config.json");
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                }
+                auto system = trace.measure("system", "graphic_system");
+            }
+            auto entries = trace.get_entries();
+                    REQUIRE_EQ(entries.size(), 3u);
+                    CHECK_EQ(entries[0].name, "app");
+                    CHECK_EQ(entries[0].depth, 0u);
+                    CHECK_EQ(entries[1].detail, "game.config.json");
+                    CHECK_EQ(entries[1].depth, 1u);
+                    CHECK_GE(entries[1].duration, std::chrono::milliseconds(2));
+                    CHECK_EQ(entries[2].depth, 1u);
+                    CHECK_GE(entries[0].duration, entries[1].duration + entries[2].duration);
+                    CHECK_GE(entries[1].start, entries[0].start);
+        }
+
+        TEST_CASE ("the recording stops at the first frame") {
+            startup_trace trace;
+            trace.restart();
+                    CHECK(trace.is_recording());
+                    CHECK_EQ(trace.get_time_to_first_frame().count(), 0);
+            {
+                auto scope = trace.measure("before");
+                        CHECK(trace.mark_first_frame());
+            }
+                    CHECK_FALSE(trace.is_recording());
+                    CHECK_FALSE(trace.mark_first_frame());
+                    CHECK_GT(trace.get_time_to_first_frame().count(), 0);
+            {
+                auto scope = trace.measure("after");
+            }
+                    CHECK_EQ(trace.get_entries().size(), 1u);
+            trace.restart();
+                    CHECK(trace.is_recording());
+                    CHECK(trace.get_entries().empty());
+        }
+
+        TEST_CASE ("a scope survives a restart") {
+            startup_trace trace;
+            auto scope = trace.measure("stale");
+            trace.restart();
+            auto fresh = trace.measure("fresh");
+            scope.close();
+            fresh.close();
+                    REQUIRE_EQ(trace.get_entries().size(), 1u);
+                    CHECK_EQ(trace.get_entries()[0].name, "fresh");
+        }
+
+        TEST_CASE ("report") {
+            startup_trace trace;
+            trace.restart();
+            {
+                auto scope = trace.measure("lua script", "tutorial.lua");
+            }
+            std::ostringstream out;
+            trace.write_report(out);
+                    CHECK_NE(out.str().find("lua script [tutorial.lua]"), std::string::npos);
+                    CHECK_NE(out.str().find("first frame not reached yet"), std::string::npos);
+            trace.mark_first_frame();
+            out.str("");
+            trace.write_report(out);
+                    CHECK_NE(out.str().find("time to first frame:"), std::string::npos);
+        }
+    }
+}
@@ -54,5 +54,30 @@ namespace antara::gaming::timer::tests {
                     CHECK_GT(time_step::get_fixed_delta_time(), 0.0f);
         }
 
+        TEST_CASE ("virtual clock") {
+            time_step::change_tps(_60tps_dt);
+            timestep.set_clock_source(clock_source::virtual_time);
+            const auto game_time = timestep.get_game_time();
+            for (int i = 0; i < 3; ++i) {
+                timestep.start_frame();
+                        CHECK(timestep.is_update_required());
+                timestep.perform_update();
+                        CHECK_FALSE(timestep.is_update_required());
+            }
+                    CHECK_EQ(0.f, timestep.get_interpolation());
+                    CHECK_EQ(timestep.get_game_time() - game_time, 3 * _60tps_dt);
+            timestep.set_clock_source(clock_source::steady);
+                    CHECK_EQ(timestep.get_clock_source(), clock_source::steady);
+        }
+
+        TEST_CASE ("time scale") {
+            timestep.set_time_scale(0.0);
+            timestep.reset_lag();
+            timestep.start_frame();
+                    CHECK_EQ(timestep.get_lag(), 0ns);
+            timestep.set_time_scale(-2.0);
+                    CHECK_EQ(timestep.get_time_scale(), 0.0);
+            timestep.set_time_scale(1.0);
+        }
     }
 }
\ No newline at end of file
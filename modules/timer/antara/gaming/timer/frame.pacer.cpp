@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <algorithm> ///< std::max
+#include <thread> ///< std::this_thread::sleep_for, std::this_thread::yield
+
+//! SDK Headers
+#include "antara/gaming/timer/frame.pacer.hpp"
+
+namespace antara::gaming::timer {
+    frame_pacer::frame_pacer(std::chrono::nanoseconds target_frame_time) noexcept :
+            target_frame_time_(target_frame_time) {
+    }
+
+    void frame_pacer::record_jitter_(std::chrono::nanoseconds jitter, bool late) noexcept {
+        stats_.nb_frames += 1;
+        stats_.nb_late_frames += late ? 1 : 0;
+        jitter_sum_ += jitter;
+        stats_.mean_jitter = jitter_sum_ / static_cast<long long>(stats_.nb_frames);
+        stats_.max_jitter = std::max(stats_.max_jitter, jitter);
+    }
+
+    void frame_pacer::wait_next_frame() noexcept {
+        auto now = clock::now();
+        if (not started_) {
+            started_ = true;
+            next_frame_ = now;
+            last_activity_ = now;
+        }
+        idle_ = idle_mode_enabled_ && now - last_activity_ >= idle_delay_;
+        const auto frame_time = get_frame_time();
+        if (frame_time == std::chrono::nanoseconds::zero()) {
+            next_frame_ = now;
+            return;
+        }
+
+        next_frame_ += frame_time;
+        if (next_frame_ <= now) {
+            record_jitter_(now - next_frame_, true);
+            next_frame_ = now;
+            return;
+        }
+        if (next_frame_ - now > spin_threshold_) {
+            std::this_thread::sleep_for(next_frame_ - now - spin_threshold_);
+        }
+        while ((now = clock::now()) < next_frame_) {
+            std::this_thread::yield();
+        }
+        record_jitter_(now - next_frame_, false);
+    }
+
+    void frame_pacer::set_target_frame_time(std::chrono::nanoseconds target_frame_time) noexcept {
+        target_frame_time_ = target_frame_time;
+    }
+
+    std::chrono::nanoseconds frame_pacer::get_frame_time() const noexcept {
+        return idle_ ? idle_frame_time_ : target_frame_time_;
+    }
+
+    void frame_pacer::set_spin_threshold(std::chrono::nanoseconds spin_threshold) noexcept {
+        spin_threshold_ = spin_threshold;
+    }
+
+    void frame_pacer::enable_idle_mode(std::chrono::nanoseconds idle_delay,
+                                       std::chrono::nanoseconds idle_frame_time) noexcept {
+        idle_mode_enabled_ = true;
+        idle_delay_ = idle_delay;
+        idle_frame_time_ = idle_frame_time;
+    }
+
+    void frame_pacer::disable_idle_mode() noexcept {
+        idle_mode_enabled_ = false;
+        idle_ = false;
+    }
+
+    void frame_pacer::notify_activity() noexcept {
+        last_activity_ = clock::now();
+        idle_ = false;
+    }
+
+    bool frame_pacer::is_idle() const noexcept {
+        return idle_;
+    }
+
+    const frame_pacer::stats &frame_pacer::get_stats() const noexcept {
+        return stats_;
+    }
+
+    void frame_pacer::reset_stats() noexcept {
+        stats_ = {};
+        jitter_sum_ = std::chrono::nanoseconds::zero();
+    }
+}
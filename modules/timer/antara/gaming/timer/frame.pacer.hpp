@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+
+//! C++ System Headers
+#include <chrono> ///< std::chrono::nanoseconds, std::chrono::steady_clock
+
+//! SDK Headers
+#include "antara/gaming/timer/fps.hpp" ///< timer::_60tps_dt
+
+namespace antara::gaming::timer {
+    /**
+     * @class frame_pacer
+     * @brief Backend independent frame limiter, waits for the next frame by sleeping then spinning on the last stretch.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The OS sleep is only precise to a millisecond or so: the pacer sleeps until spin_threshold before the deadline and spins on the rest.
+     *         A frame which ends past its deadline is not waited for, the next deadline starts from now, so late frames are not followed by a burst.
+     *         In idle mode, the pacer drops to the idle frame time once no activity was notified for the idle delay.
+     * @endverbatim
+     */
+    class frame_pacer {
+        //! Private typedefs
+        using clock = std::chrono::steady_clock;
+    public:
+        //! Public typedefs
+
+        /// @brief pacing jitter: how late the frames started compared to their deadline
+        struct stats {
+            std::size_t nb_frames{0u};
+            std::size_t nb_late_frames{0u}; ///< frames which ended past their deadline
+            std::chrono::nanoseconds mean_jitter{0};
+            std::chrono::nanoseconds max_jitter{0};
+        };
+
+    private:
+        //! Private fields
+        std::chrono::nanoseconds target_frame_time_;
+        std::chrono::nanoseconds spin_threshold_{std::chrono::milliseconds(2)};
+        std::chrono::nanoseconds idle_delay_{0};
+        std::chrono::nanoseconds idle_frame_time_{std::chrono::milliseconds(100)};
+        bool idle_mode_enabled_{false};
+        bool idle_{false};
+        bool started_{false};
+        clock::time_point next_frame_;
+        clock::time_point last_activity_;
+        std::chrono::nanoseconds jitter_sum_{0};
+        stats stats_;
+
+        void record_jitter_(std::chrono::nanoseconds jitter, bool late) noexcept;
+
+    public:
+        //! Constructor
+
+        /// @param target_frame_time time between two frames, 0 for no limit
+        explicit frame_pacer(std::chrono::nanoseconds target_frame_time = _60tps_dt) noexcept;
+
+        //! Public member functions
+
+        /// @brief block until the next frame is due, to call once per frame.
+        void wait_next_frame() noexcept;
+
+        /// @param target_frame_time time between two frames, 0 for no limit
+        void set_target_frame_time(std::chrono::nanoseconds target_frame_time) noexcept;
+
+        /// @return time between two frames in the current mode (idle or active), 0 for no limit
+        [[nodiscard]] std::chrono::nanoseconds get_frame_time() const noexcept;
+
+        /// @param spin_threshold part of the wait spent spinning instead of sleeping
+        void set_spin_threshold(std::chrono::nanoseconds spin_threshold) noexcept;
+
+        /**
+         * @brief drop to a low frame rate when no activity was notified for a while.
+         * @param idle_delay inactivity before going idle
+         * @param idle_frame_time time between two frames while idle
+         */
+        void enable_idle_mode(std::chrono::nanoseconds idle_delay,
+                              std::chrono::nanoseconds idle_frame_time = std::chrono::milliseconds(100)) noexcept;
+
+        void disable_idle_mode() noexcept;
+
+        /// @brief input or dirty state: leave the idle mode and restart the idle delay.
+        void notify_activity() noexcept;
+
+        [[nodiscard]] bool is_idle() const noexcept;
+
+        [[nodiscard]] const stats &get_stats() const noexcept;
+
+        void reset_stats() noexcept;
+    };
+}
@@ -0,0 +1,207 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C System Headers
+#include <cmath> ///< std::ceil
+
+//! C++ System Headers
+#include <algorithm> ///< std::max, std::min
+
+//! SDK Headers
+#include "antara/gaming/timer/frame.recorder.hpp"
+
+//! Anonymous Implementation
+namespace {
+    constexpr std::size_t sub_buckets_bits = 3u;
+    constexpr std::size_t sub_buckets = 1u << sub_buckets_bits;
+
+    std::size_t most_significant_bit(std::uint64_t value) noexcept {
+        std::size_t msb = 0u;
+        while (value >>= 1u) {
+            ++msb;
+        }
+        return msb;
+    }
+
+    double to_us(std::chrono::nanoseconds duration) noexcept {
+        return static_cast<double>(duration.count()) / 1000.0;
+    }
+}
+
+namespace antara::gaming::timer {
+    std::size_t frame_histogram::bucket_of(std::chrono::nanoseconds duration) noexcept {
+        const auto us = static_cast<std::uint64_t>(std::max<std::int64_t>(duration.count() / 1000, 0));
+        if (us < 2u * sub_buckets) {
+            return static_cast<std::size_t>(us);
+        }
+        const auto msb = most_significant_bit(us);
+        const auto shift = msb - sub_buckets_bits;
+        const auto bucket = (msb - sub_buckets_bits) * sub_buckets + static_cast<std::size_t>(us >> shift);
+        return std::min(bucket, nb_buckets - 1u);
+    }
+
+    std::chrono::nanoseconds frame_histogram::upper_bound_of(std::size_t bucket) noexcept {
+        if (bucket < 2u * sub_buckets) {
+            return std::chrono::microseconds(bucket + 1u) - std::chrono::nanoseconds(1);
+        }
+        const auto shift = bucket / sub_buckets - 1u;
+        const auto mantissa = static_cast<std::uint64_t>(bucket % sub_buckets + sub_buckets);
+        return std::chrono::microseconds((mantissa + 1u) << shift) - std::chrono::nanoseconds(1);
+    }
+
+    void frame_histogram::add(std::chrono::nanoseconds duration) noexcept {
+        ++buckets_[bucket_of(duration)];
+        ++count_;
+    }
+
+    void frame_histogram::remove(std::chrono::nanoseconds duration) noexcept {
+        --buckets_[bucket_of(duration)];
+        --count_;
+    }
+
+    std::chrono::nanoseconds frame_histogram::percentile(double ratio) const noexcept {
+        if (count_ == 0u) {
+            return std::chrono::nanoseconds::zero();
+        }
+        const auto rank = std::max<std::uint64_t>(1u, static_cast<std::uint64_t>(std::ceil(ratio * count_)));
+        std::uint64_t cumulated = 0u;
+        for (std::size_t idx = 0u; idx < nb_buckets; ++idx) {
+            cumulated += buckets_[idx];
+            if (cumulated >= rank) {
+                return upper_bound_of(idx);
+            }
+        }
+        return upper_bound_of(nb_buckets - 1u);
+    }
+
+    std::uint64_t frame_histogram::count() const noexcept {
+        return count_;
+    }
+
+    void frame_histogram::clear() noexcept {
+        buckets_.fill(0u);
+        count_ = 0u;
+    }
+}
+
+namespace antara::gaming::timer {
+    template<typename TFunctor>
+    void frame_recorder::for_each_sample_(TFunctor &&functor) const {
+        for (std::size_t idx = 0u; idx < window_size_; ++idx) {
+            functor(window_[(window_begin_ + idx) % window_capacity]);
+        }
+    }
+
+    void frame_recorder::record(std::chrono::nanoseconds frame_time, std::size_t nb_logic_ticks,
+                                std::chrono::nanoseconds lag) noexcept {
+        if (window_size_ == window_capacity) {
+            window_histogram_.remove(window_[window_begin_].frame_time);
+            window_begin_ = (window_begin_ + 1u) % window_capacity;
+            --window_size_;
+        }
+        window_[(window_begin_ + window_size_) % window_capacity] = {frame_time, lag,
+                                                                     static_cast<std::uint32_t>(nb_logic_ticks)};
+        ++window_size_;
+        window_histogram_.add(frame_time);
+        total_histogram_.add(frame_time);
+        total_max_ = std::max(total_max_, frame_time);
+        total_logic_ticks_ += nb_logic_ticks;
+        total_max_lag_ = std::max(total_max_lag_, lag);
+    }
+
+    frame_percentiles frame_recorder::window_percentiles() const noexcept {
+        std::chrono::nanoseconds max{0};
+        for_each_sample_([&max](const sample &smp) { max = std::max(max, smp.frame_time); });
+        return {std::min(window_histogram_.percentile(0.50), max), std::min(window_histogram_.percentile(0.95), max),
+                std::min(window_histogram_.percentile(0.99), max), max};
+    }
+
+    frame_percentiles frame_recorder::total_percentiles() const noexcept {
+        return {std::min(total_histogram_.percentile(0.50), total_max_),
+                std::min(total_histogram_.percentile(0.95), total_max_),
+                std::min(total_histogram_.percentile(0.99), total_max_), total_max_};
+    }
+
+    std::size_t frame_recorder::window_size() const noexcept {
+        return window_size_;
+    }
+
+    std::uint64_t frame_recorder::nb_frames() const noexcept {
+        return total_histogram_.count();
+    }
+
+    float frame_recorder::mean_logic_ticks() const noexcept {
+        if (window_size_ == 0u) {
+            return 0.f;
+        }
+        std::uint64_t sum = 0u;
+        for_each_sample_([&sum](const sample &smp) { sum += smp.nb_logic_ticks; });
+        return static_cast<float>(sum) / static_cast<float>(window_size_);
+    }
+
+    std::uint32_t frame_recorder::max_logic_ticks() const noexcept {
+        std::uint32_t max = 0u;
+        for_each_sample_([&max](const sample &smp) { max = std::max(max, smp.nb_logic_ticks); });
+        return max;
+    }
+
+    std::chrono::nanoseconds frame_recorder::max_lag() const noexcept {
+        std::chrono::nanoseconds max{0};
+        for_each_sample_([&max](const sample &smp) { max = std::max(max, smp.lag); });
+        return max;
+    }
+
+    float frame_recorder::total_mean_logic_ticks() const noexcept {
+        if (nb_frames() == 0u) {
+            return 0.f;
+        }
+        return static_cast<float>(total_logic_ticks_) / static_cast<float>(nb_frames());
+    }
+
+    std::chrono::nanoseconds frame_recorder::total_max_lag() const noexcept {
+        return total_max_lag_;
+    }
+
+    void frame_recorder::write_csv(std::ostream &out) const {
+        out << "frame,frame_time_us,logic_ticks,lag_us\n";
+        const auto first_frame = nb_frames() - window_size_;
+        std::uint64_t frame = first_frame;
+        for_each_sample_([&out, &frame](const sample &smp) {
+            out << frame++ << ',' << to_us(smp.frame_time) << ',' << smp.nb_logic_ticks << ',' << to_us(smp.lag) << '\n';
+        });
+    }
+
+    void frame_recorder::write_csv_summary(std::ostream &out) const {
+        out << "scope,frames,p50_us,p95_us,p99_us,max_us,mean_logic_ticks,max_lag_us\n";
+        auto write_row = [&out](const char *scope, std::uint64_t frames, const frame_percentiles &pct,
+                                float mean_ticks, std::chrono::nanoseconds lag) {
+            out << scope << ',' << frames << ',' << to_us(pct.p50) << ',' << to_us(pct.p95) << ',' << to_us(pct.p99)
+                << ',' << to_us(pct.max) << ',' << mean_ticks << ',' << to_us(lag) << '\n';
+        };
+        write_row("window", window_size_, window_percentiles(), mean_logic_ticks(), max_lag());
+        write_row("total", nb_frames(), total_percentiles(), total_mean_logic_ticks(), total_max_lag());
+    }
+
+    void frame_recorder::reset() noexcept {
+        window_begin_ = 0u;
+        window_size_ = 0u;
+        window_histogram_.clear();
+        total_histogram_.clear();
+        total_max_ = std::chrono::nanoseconds::zero();
+        total_logic_ticks_ = 0u;
+        total_max_lag_ = std::chrono::nanoseconds::zero();
+    }
+}
@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint32_t, std::uint64_t
+
+//! C++ System Headers
+#include <array> ///< std::array
+#include <chrono> ///< std::chrono::nanoseconds
+#include <ostream> ///< std::ostream
+
+namespace antara::gaming::timer {
+    /**
+     * @class frame_histogram
+     * @brief Log-bucketed histogram of durations: 8 buckets per power of two of microseconds, so a percentile is precise to ~12%.
+     */
+    class frame_histogram {
+    public:
+        //! Public constants
+        static constexpr std::size_t nb_buckets = 240u;
+
+        //! Public static functions
+        [[nodiscard]] static std::size_t bucket_of(std::chrono::nanoseconds duration) noexcept;
+
+        /// @return highest duration falling in the bucket
+        [[nodiscard]] static std::chrono::nanoseconds upper_bound_of(std::size_t bucket) noexcept;
+
+        //! Public member functions
+        void add(std::chrono::nanoseconds duration) noexcept;
+
+        void remove(std::chrono::nanoseconds duration) noexcept;
+
+        /// @param ratio between 0 and 1, eg: 0.99 for the 99th percentile
+        [[nodiscard]] std::chrono::nanoseconds percentile(double ratio) const noexcept;
+
+        [[nodiscard]] std::uint64_t count() const noexcept;
+
+        void clear() noexcept;
+
+    private:
+        //! Private fields
+        std::array<std::uint32_t, nb_buckets> buckets_{};
+        std::uint64_t count_{0u};
+    };
+
+    //! Frame time percentiles
+    struct frame_percentiles {
+        std::chrono::nanoseconds p50{0};
+        std::chrono::nanoseconds p95{0};
+        std::chrono::nanoseconds p99{0};
+        std::chrono::nanoseconds max{0};
+    };
+
+    /**
+     * @class frame_recorder
+     * @brief Allocation free recorder of the frame times, logic ticks per frame and lag.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         The last window_capacity frames are kept in a ring, along with a histogram of the window updated as frames come and go,
+     *         and a histogram of every frame since the last reset.
+     *         The system_manager records a frame at each update as soon as a frame_recorder is set in the registry context.
+     * @endverbatim
+     */
+    class frame_recorder {
+    public:
+        //! Public typedefs
+        struct sample {
+            std::chrono::nanoseconds frame_time{0};
+            std::chrono::nanoseconds lag{0};
+            std::uint32_t nb_logic_ticks{0u};
+        };
+
+        //! Public constants
+        static constexpr std::size_t window_capacity = 1024u;
+
+        //! Public member functions
+        void record(std::chrono::nanoseconds frame_time, std::size_t nb_logic_ticks, std::chrono::nanoseconds lag) noexcept;
+
+        /// @return percentiles of the last window_capacity frames, max is exact
+        [[nodiscard]] frame_percentiles window_percentiles() const noexcept;
+
+        /// @return percentiles of every frame since the last reset, max is exact
+        [[nodiscard]] frame_percentiles total_percentiles() const noexcept;
+
+        [[nodiscard]] std::size_t window_size() const noexcept;
+
+        [[nodiscard]] std::uint64_t nb_frames() const noexcept;
+
+        /// @return mean number of logic ticks per frame over the window
+        [[nodiscard]] float mean_logic_ticks() const noexcept;
+
+        /// @return highest number of logic ticks in a frame over the window
+        [[nodiscard]] std::uint32_t max_logic_ticks() const noexcept;
+
+        /// @return highest lag left after the logic ticks over the window
+        [[nodiscard]] std::chrono::nanoseconds max_lag() const noexcept;
+
+        /// @return mean number of logic ticks per frame since the last reset
+        [[nodiscard]] float total_mean_logic_ticks() const noexcept;
+
+        /// @return highest lag left after the logic ticks since the last reset
+        [[nodiscard]] std::chrono::nanoseconds total_max_lag() const noexcept;
+
+        /// @brief write the samples of the window, oldest first: frame,frame_time_us,logic_ticks,lag_us
+        void write_csv(std::ostream &out) const;
+
+        /// @brief write one row for the window and one for every frame: scope,frames,p50_us,p95_us,p99_us,max_us,mean_logic_ticks,max_lag_us
+        void write_csv_summary(std::ostream &out) const;
+
+        void reset() noexcept;
+
+    private:
+        //! Private fields
+        std::array<sample, window_capacity> window_{};
+        std::size_t window_begin_{0u};
+        std::size_t window_size_{0u};
+        frame_histogram window_histogram_;
+        frame_histogram total_histogram_;
+        std::chrono::nanoseconds total_max_{0};
+        std::uint64_t total_logic_ticks_{0u};
+        std::chrono::nanoseconds total_max_lag_{0};
+
+        //! Private member functions
+        template<typename TFunctor>
+        void for_each_sample_(TFunctor &&functor) const;
+    };
+}
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C System Headers
+#include <cstdio> ///< std::snprintf
+
+//! C++ System Headers
+#include <algorithm> ///< std::stable_sort
+#include <utility> ///< std::exchange
+
+//! SDK Headers
+#include "antara/gaming/timer/startup.trace.hpp"
+
+//! Anonymous Implementation
+namespace {
+    //! Initialized with the other statics, before main
+    const auto program_load = std::chrono::steady_clock::now();
+
+    //! Nesting of the opened scopes, per thread
+    thread_local std::size_t current_depth = 0u;
+
+    double to_ms(std::chrono::nanoseconds duration) noexcept {
+        return static_cast<double>(duration.count()) / 1000000.0;
+    }
+}
+
+namespace antara::gaming::timer {
+    startup_trace::scope::scope(startup_trace *trace, std::size_t index, std::uint64_t generation) noexcept :
+            trace_(trace), index_(index), generation_(generation) {
+    }
+
+    startup_trace::scope::scope(scope &&other) noexcept :
+            trace_(std::exchange(other.trace_, nullptr)), index_(other.index_), generation_(other.generation_) {
+    }
+
+    startup_trace::scope &startup_trace::scope::operator=(scope &&other) noexcept {
+        if (this != &other) {
+            close();
+            trace_ = std::exchange(other.trace_, nullptr);
+            index_ = other.index_;
+            generation_ = other.generation_;
+        }
+        return *this;
+    }
+
+    startup_trace::scope::~scope() noexcept {
+        close();
+    }
+
+    void startup_trace::scope::close() noexcept {
+        if (trace_ != nullptr) {
+            std::exchange(trace_, nullptr)->close_(index_, generation_);
+        }
+    }
+
+    startup_trace::startup_trace() noexcept : origin_(program_load) {
+    }
+
+    startup_trace &startup_trace::shared() noexcept {
+        static startup_trace trace;
+        return trace;
+    }
+
+    startup_trace::scope startup_trace::measure(std::string_view name, std::string_view detail) noexcept {
+        if (not recording_) {
+            return scope{};
+        }
+        const auto now = clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.push_back(entry{std::string(name), std::string(detail),
+                                 std::chrono::duration_cast<std::chrono::nanoseconds>(now - origin_),
+                                 std::chrono::nanoseconds(0), current_depth++});
+        return scope{this, entries_.size() - 1u, generation_};
+    }
+
+    void startup_trace::close_(std::size_t index, std::uint64_t generation) noexcept {
+        const auto now = clock::now();
+        if (current_depth > 0u) {
+            --current_depth;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (generation != generation_ || index >= entries_.size()) {
+            return;
+        }
+        auto &current = entries_[index];
+        current.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(now - origin_) - current.start;
+    }
+
+    bool startup_trace::mark_first_frame() noexcept {
+        const auto now = clock::now();
+        if (not recording_.exchange(false)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        time_to_first_frame_ = std::chrono::duration_cast<std::chrono::nanoseconds>(now - origin_);
+        return true;
+    }
+
+    bool startup_trace::is_recording() const noexcept {
+        return recording_;
+    }
+
+    std::chrono::nanoseconds startup_trace::get_time_to_first_frame() const noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return time_to_first_frame_;
+    }
+
+    std::vector<startup_trace::entry> startup_trace::get_entries() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_;
+    }
+
+    void startup_trace::write_report(std::ostream &out) const {
+        auto entries = get_entries();
+        std::stable_sort(entries.begin(), entries.end(), [](const entry &lhs, const entry &rhs) {
+            return lhs.start < rhs.start;
+        });
+        char line[64];
+        for (auto &&current: entries) {
+            std::snprintf(line, sizeof(line), "%9.3f ms %9.3f ms ", to_ms(current.start), to_ms(current.duration));
+            out << line << std::string(current.depth * 2u, ' ') << current.name;
+            if (not current.detail.empty()) {
+                out << " [" << current.detail << "]";
+            }
+            out << '\n';
+        }
+        const auto first_frame = get_time_to_first_frame();
+        if (first_frame.count() == 0) {
+            out << "first frame not reached yet\n";
+            return;
+        }
+        std::snprintf(line, sizeof(line), "%9.3f ms", to_ms(first_frame));
+        out << "time to first frame: " << line;
+        if (first_frame > first_frame_budget) {
+            out << " (over the " << first_frame_budget.count() << " ms budget)";
+        }
+        out << '\n';
+    }
+
+    void startup_trace::restart() noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        ++generation_;
+        origin_ = clock::now();
+        time_to_first_frame_ = std::chrono::nanoseconds(0);
+        recording_ = true;
+    }
+}
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <atomic> ///< std::atomic_bool
+#include <chrono> ///< std::chrono::nanoseconds, std::chrono::steady_clock
+#include <mutex> ///< std::mutex
+#include <ostream> ///< std::ostream
+#include <string> ///< std::string
+#include <string_view> ///< std::string_view
+#include <vector> ///< std::vector
+
+namespace antara::gaming::timer {
+    /**
+     * @class startup_trace
+     * @brief Records how long each step of the startup took (constructors, config and script loading) until the first frame.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Times are relative to the load of the program. Scopes opened inside another scope of the same thread are nested in the report.
+     *         The system_manager marks the first frame at the end of its first update, the trace stops recording from there:
+     *         measure() is then a no-op and costs nothing but a branch.
+     * @endverbatim
+     */
+    class startup_trace {
+        //! Private typedefs
+        using clock = std::chrono::steady_clock;
+    public:
+        //! Public typedefs
+        struct entry {
+            std::string name;
+            std::string detail;
+            std::chrono::nanoseconds start{0}; ///< since the program load
+            std::chrono::nanoseconds duration{0};
+            std::size_t depth{0u};
+        };
+
+        /// @brief RAII timing of a startup step, the step ends when the scope is destroyed.
+        class scope {
+        public:
+            scope() noexcept = default;
+
+            scope(startup_trace *trace, std::size_t index, std::uint64_t generation) noexcept;
+
+            scope(scope &&other) noexcept;
+
+            scope &operator=(scope &&other) noexcept;
+
+            scope(const scope &) = delete;
+
+            scope &operator=(const scope &) = delete;
+
+            ~scope() noexcept;
+
+            /// @brief end the step now instead of at destruction.
+            void close() noexcept;
+
+        private:
+            startup_trace *trace_{nullptr};
+            std::size_t index_{0u};
+            std::uint64_t generation_{0u};
+        };
+
+        //! Public constants
+        static constexpr std::chrono::milliseconds first_frame_budget{100};
+
+        //! Public static functions
+
+        /// @return the trace of the process
+        static startup_trace &shared() noexcept;
+
+        //! Public member functions
+
+        /**
+         * @param name step of the startup, eg: "system", "lua script"
+         * @param detail what is processed by the step, eg: the system or the script name
+         * @return a scope which records the step once destroyed, an inactive scope if the trace is no longer recording
+         */
+        [[nodiscard]] scope measure(std::string_view name, std::string_view detail = {}) noexcept;
+
+        /**
+         * @brief stop the recording and keep the time elapsed since the program load.
+         * @return true the first time it is called since the last restart, false otherwise
+         */
+        bool mark_first_frame() noexcept;
+
+        [[nodiscard]] bool is_recording() const noexcept;
+
+        /// @return time between the program load and the first frame, 0 if the first frame is not marked yet
+        [[nodiscard]] std::chrono::nanoseconds get_time_to_first_frame() const noexcept;
+
+        [[nodiscard]] std::vector<entry> get_entries() const;
+
+        /// @brief write the steps in starting order, indented by depth, followed by the time to first frame.
+        void write_report(std::ostream &out) const;
+
+        /// @brief clear the trace and record again, times are relative to now.
+        void restart() noexcept;
+
+    private:
+        //! Private fields
+        clock::time_point origin_;
+        std::chrono::nanoseconds time_to_first_frame_{0};
+        std::vector<entry> entries_;
+        std::uint64_t generation_{0u};
+        std::atomic_bool recording_{true};
+        mutable std::mutex mutex_;
+
+        //! Private member functions
+        void close_(std::size_t index, std::uint64_t generation) noexcept;
+
+    public:
+        //! Constructor
+        startup_trace() noexcept;
+    };
+}
@@ -23,13 +23,6 @@
 namespace antara::gaming::timer {
     //! Static member initialization
     std::chrono::nanoseconds time_step::tps_dt = _60tps_dt;
-    std::chrono::nanoseconds time_step::lag_ = 0ns;
-
-    float time_step::fps_time_sum_ = 0.0f;
-    int time_step::fps_capture_count_ = 0;
-    std::string time_step::fps_str_ = "";
-    using clock = std::chrono::steady_clock;
-    clock::time_point time_step::start_ = clock::now();
     float time_step::fixed_delta_time{std::chrono::duration<float, std::ratio<1>>(tps_dt).count()};
 }
 
@@ -41,7 +34,14 @@ namespace antara::gaming::timer {
     void time_step::start_frame() noexcept {
         auto deltaTime = clock::now() - start_;
         start_ = clock::now();
-        lag_ += std::chrono::duration_cast<std::chrono::nanoseconds>(deltaTime);
+        last_frame_time_ = std::chrono::duration_cast<std::chrono::nanoseconds>(deltaTime);
+        if (clock_source_ == clock_source::virtual_time) {
+            lag_ += tps_dt;
+        } else if (time_scale_ != 1.0) {
+            lag_ += std::chrono::duration_cast<std::chrono::nanoseconds>(last_frame_time_ * time_scale_);
+        } else {
+            lag_ += last_frame_time_;
+        }
 
         float elapsed_time = std::chrono::duration<float, std::ratio<1>>(deltaTime).count();
         fps_time_sum_ += elapsed_time;
@@ -65,6 +65,7 @@ namespace antara::gaming::timer {
 
     void time_step::perform_update() noexcept {
         lag_ -= tps_dt;
+        game_time_ += tps_dt;
     }
 
     void time_step::change_tps(std::chrono::nanoseconds new_tps_rate) {
@@ -76,6 +77,10 @@ namespace antara::gaming::timer {
         return fixed_delta_time;
     }
 
+    std::chrono::nanoseconds time_step::get_tps_dt() noexcept {
+        return tps_dt;
+    }
+
     float time_step::get_interpolation() const noexcept {
         return std::chrono::duration<float, std::ratio<1>>(lag_).count() /
                std::chrono::duration<float, std::ratio<1>>(tps_dt).count();
@@ -85,4 +90,33 @@ namespace antara::gaming::timer {
         lag_ = std::chrono::nanoseconds(0);
         start();
     }
-}
\ No newline at end of file
+
+    std::chrono::nanoseconds time_step::get_last_frame_time() const noexcept {
+        return last_frame_time_;
+    }
+
+    std::chrono::nanoseconds time_step::get_lag() const noexcept {
+        return lag_;
+    }
+
+    std::chrono::nanoseconds time_step::get_game_time() const noexcept {
+        return game_time_;
+    }
+
+    void time_step::set_clock_source(clock_source source) noexcept {
+        clock_source_ = source;
+        reset_lag();
+    }
+
+    void time_step::set_time_scale(double scale) noexcept {
+        time_scale_ = scale > 0.0 ? scale : 0.0;
+    }
+
+    clock_source time_step::get_clock_source() const noexcept {
+        return clock_source_;
+    }
+
+    double time_step::get_time_scale() const noexcept {
+        return time_scale_;
+    }
+}
@@ -24,38 +24,81 @@
 #include "antara/gaming/timer/fps.hpp"
 
 namespace antara::gaming::timer {
+    /**
+     * @brief source of the elapsed time fed to the time_step every frame.
+     *
+     * steady: elapsed time of std::chrono::steady_clock, multiplied by the time scale.
+     * virtual_time: exactly one tps_dt per frame, the logic ticks run back-to-back as fast as the CPU allows (headless runs, bot testing).
+     */
+    enum class clock_source {
+        steady,
+        virtual_time
+    };
+
+    /**
+     * @class time_step
+     * @brief Fixed logic rate accumulator of a game loop.
+     * @note the logic rate is shared by the whole process, the accumulated lag, the clock source and the fps are per instance
+     * so every system_manager keeps its own pace.
+     */
     class time_step {
         //! Private typedefs
         using clock = std::chrono::steady_clock;
 
-        //! Private fields
+        //! Private static fields
         static std::chrono::nanoseconds tps_dt;
         static float fixed_delta_time;
-        static std::chrono::nanoseconds lag_;
-        static clock::time_point start_;
         static constexpr float fps_average_every_seconds_{1.0f};
-        static float fps_time_sum_;
-        static int fps_capture_count_;
+
+        //! Private fields
+        std::chrono::nanoseconds lag_{0};
+        std::chrono::nanoseconds last_frame_time_{0};
+        std::chrono::nanoseconds game_time_{0};
+        clock_source clock_source_{clock_source::steady};
+        double time_scale_{1.0};
+        clock::time_point start_{clock::now()};
+        float fps_time_sum_{0.0f};
+        int fps_capture_count_{0};
     public:
         //! Public static functions
-        static void start() noexcept;
-
-        static void start_frame() noexcept;
-
-        static void perform_update() noexcept;
-
         static void change_tps(std::chrono::nanoseconds new_tps_rate);
 
         static float get_fixed_delta_time() noexcept;
 
-        static void reset_lag() noexcept;
+        /// @return duration of a logic tick, shared by the whole process
+        static std::chrono::nanoseconds get_tps_dt() noexcept;
 
         //! Public member functions
+        void start() noexcept;
+
+        void start_frame() noexcept;
+
+        void perform_update() noexcept;
+
+        void reset_lag() noexcept;
+
+        void set_clock_source(clock_source source) noexcept;
+
+        /// @param scale multiplier of the steady clock elapsed time, eg: 0.5 for a slow motion, 10 to run ten times faster
+        void set_time_scale(double scale) noexcept;
+
         [[nodiscard]] bool is_update_required() const noexcept;
 
         [[nodiscard]] float get_interpolation() const noexcept;
 
+        //! Public getters
+        [[nodiscard]] std::chrono::nanoseconds get_last_frame_time() const noexcept;
+
+        [[nodiscard]] std::chrono::nanoseconds get_lag() const noexcept;
+
+        /// @return time simulated by the logic ticks of this instance, it follows the clock source and the time scale
+        [[nodiscard]] std::chrono::nanoseconds get_game_time() const noexcept;
+
+        [[nodiscard]] clock_source get_clock_source() const noexcept;
+
+        [[nodiscard]] double get_time_scale() const noexcept;
+
         //! Public Fields
-        static std::string fps_str_;
+        std::string fps_str_;
     };
 }
\ No newline at end of file
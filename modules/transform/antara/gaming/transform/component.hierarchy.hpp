@@ -0,0 +1,46 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstdint> ///< std::uint32_t
+
+//! Dependencies Headers
+#include <entt/entity/entity.hpp> ///< entt::entity, entt::null
+
+//! SDK Headers
+#include "antara/gaming/core/safe.refl.hpp" ///< REFL_AUTO
+#include "antara/gaming/math/vector.hpp" ///< math::vec2f
+
+namespace antara::gaming::transform {
+    /**
+     * @struct parent_2d
+     * @brief Attach an entity to a parent entity.
+     * @note position_2d and properties (scale, rotation) of the child become its world transform,
+     *       computed by ecs::hierarchy_system from the parent world transform and the local transform below.
+     */
+    struct parent_2d {
+        entt::entity entity{entt::null};
+        math::vec2f local_position{math::vec2f::scalar(0.f)};
+        math::vec2f local_scale{math::vec2f::scalar(1.f)};
+        float local_rotation{0.f};
+        std::uint32_t depth{0u}; //! Will be modified internally but not from the user
+    };
+}
+
+REFL_AUTO(type(antara::gaming::transform::parent_2d), field(entity), field(local_position), field(local_scale),
+          field(local_rotation), field(depth))
@@ -43,6 +43,22 @@ namespace antara::gaming::transform {
         previous_position_2d(float x, float y) noexcept : math::vec2f(x, y) {}
     };
 
+    //! Position to draw for dynamic entities, written every frame by the batched interpolation pass.
+    struct interpolated_position_2d : public math::vec2f {
+        template<typename ... Args>
+        interpolated_position_2d(Args &&...args) noexcept: math::vec2f(std::forward<Args>(args)...) {}
+
+        interpolated_position_2d() noexcept = default;
+
+        interpolated_position_2d(const interpolated_position_2d &other) noexcept = default;
+
+        interpolated_position_2d &operator=(const interpolated_position_2d &other) noexcept = default;
+
+        interpolated_position_2d(math::vec2f pos) noexcept : math::vec2f(pos) {}
+
+        interpolated_position_2d(float x, float y) noexcept : math::vec2f(x, y) {}
+    };
+
     struct position_2d : public math::vec2f {
         template<typename ... Args>
         position_2d(Args &&...args) noexcept: math::vec2f(std::forward<Args>(args)...) {}
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+
+//! SDK Headers
+#include "antara/gaming/ecs/system.hpp" ///< ecs::logic_update_system
+#include "antara/gaming/world/world.host.hpp" ///< world::host
+
+namespace antara::gaming::world::tests
+{
+    struct match_rules
+    {
+        std::size_t nb_ticks{0u};
+    };
+
+    class match_system final : public ecs::logic_update_system<match_system>
+    {
+    public:
+        match_system(entt::registry &registry, int match_id) : system(registry), match_id_(match_id)
+        {
+        }
+
+        void update() noexcept final
+        {
+            const auto *rules = this->entity_registry_.ctx<shared_resources>().get<match_rules>();
+            if (++nb_ticks_ == rules->nb_ticks) {
+                this->dispatcher_.trigger<event::quit_game>(match_id_);
+            }
+        }
+
+    private:
+        int match_id_;
+        std::size_t nb_ticks_{0u};
+    };
+}
+
+REFL_AUTO(type(antara::gaming::world::tests::match_system))
+
+namespace antara::gaming::world::tests
+{
+    TEST_SUITE ("world host")
+    {
+        TEST_CASE ("independent worlds stepped across a worker pool")
+        {
+            host world_host{2u};
+            world_host.share<match_rules>(match_rules{10u});
+            std::vector<host::world_id> ids;
+            for (int i = 0; i < 16; ++i) {
+                ids.push_back(world_host.add_world([i](hosted_world &world) {
+                    world.get_system_manager().create_system<match_system>(i);
+                }));
+            }
+                    CHECK_EQ(world_host.nb_worlds(), 16u);
+                    CHECK_EQ(world_host.nb_running_worlds(), 16u);
+            world_host.run();
+                    CHECK_EQ(world_host.nb_running_worlds(), 0u);
+            for (int i = 0; i < 16; ++i) {
+                auto *world = world_host.get_world(ids[i]);
+                REQUIRE(world != nullptr);
+                        CHECK_EQ(world->get_return_value(), i);
+                        CHECK_EQ(world->get_nb_frames(), 10u);
+                        CHECK_EQ(world->get_system_manager().get_logic_tick(), 10u);
+            }
+                    CHECK_GT(world_host.get_total_cpu_time().count(), 0);
+                    CHECK_EQ(world_host.step(), 0u);
+        }
+
+        TEST_CASE ("removed worlds free their identifier")
+        {
+            host world_host{0u};
+            auto first = world_host.add_world([](hosted_world &) {});
+            world_host.remove_world(first);
+                    CHECK_EQ(world_host.get_world(first), nullptr);
+                    CHECK_EQ(world_host.nb_worlds(), 0u);
+                    CHECK_EQ(world_host.add_world([](hosted_world &) {}), first);
+        }
+    }
+}
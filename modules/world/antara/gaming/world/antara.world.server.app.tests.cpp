@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <doctest/doctest.h>
+
+//! SDK Headers
+#include "antara/gaming/ecs/system.hpp" ///< ecs::logic_update_system
+#include "antara/gaming/timer/time.step.hpp" ///< timer::time_step
+#include "antara/gaming/world/server.app.hpp" ///< world::server_app
+
+namespace antara::gaming::world::tests
+{
+    class server_logic_system final : public ecs::logic_update_system<server_logic_system>
+    {
+    public:
+        server_logic_system(entt::registry &registry) : system(registry)
+        {
+        }
+
+        void update() noexcept final
+        {
+            if (++nb_ticks == 100ull) {
+                this->dispatcher_.trigger<event::quit_game>(7);
+            }
+        }
+
+        std::size_t nb_ticks{0ull};
+    };
+}
+
+REFL_AUTO(type(antara::gaming::world::tests::server_logic_system))
+
+namespace antara::gaming::world::tests
+{
+    class concrete_server : public world::server_app
+    {
+    public:
+        concrete_server(std::chrono::nanoseconds tick_rate) : server_app(tick_rate)
+        {
+            system_manager_.create_system<server_logic_system>();
+        }
+
+        void use_virtual_clock()
+        {
+            entity_registry_.ctx<timer::time_step>().set_clock_source(timer::clock_source::virtual_time);
+        }
+    };
+
+    TEST_SUITE ("server app")
+    {
+        TEST_CASE ("runs the logic at a high tick rate")
+        {
+            concrete_server server{std::chrono::milliseconds(1)};
+            auto start = std::chrono::steady_clock::now();
+                    CHECK_EQ(server.run(), 7);
+                    CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+            timer::time_step::change_tps(timer::_60tps_dt);
+        }
+
+        TEST_CASE ("live servers share the tick rate of the process")
+        {
+            {
+                concrete_server first{std::chrono::milliseconds(2)};
+                concrete_server second{std::chrono::milliseconds(2)};
+                        CHECK_EQ(timer::time_step::get_tps_dt(), std::chrono::milliseconds(2));
+            }
+            concrete_server alone{timer::_60tps_dt};
+                    CHECK_EQ(timer::time_step::get_tps_dt(), timer::_60tps_dt);
+        }
+
+        TEST_CASE ("runs as fast as possible on the virtual clock")
+        {
+            concrete_server server{timer::_60tps_dt};
+            server.use_virtual_clock();
+                    CHECK_EQ(server.run(), 7);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C System Headers
+#include <cassert> ///< assert
+
+//! Dependencies Headers
+#include <loguru.hpp> ///< LOG_SCOPE_FUNCTION DVLOG_F
+
+//! SDK Headers
+#include "antara/gaming/event/start.game.hpp" ///< event::start_game
+#include "antara/gaming/timer/time.step.hpp" ///< timer::time_step, timer::clock_source
+#include "antara/gaming/world/server.app.hpp"
+
+namespace antara::gaming::world {
+    //! Static member initialization
+    std::atomic_size_t server_app::nb_live_servers_{0u};
+
+    //! Constructor
+    server_app::server_app(std::chrono::nanoseconds tick_rate) noexcept {
+        LOG_SCOPE_FUNCTION(INFO);
+        if (nb_live_servers_.fetch_add(1u) == 0u) {
+            timer::time_step::change_tps(tick_rate);
+        } else if (tick_rate != timer::time_step::get_tps_dt()) {
+            VLOG_F(loguru::Verbosity_ERROR,
+                   "the tick rate is shared by every server of the process, keeping {} ns instead of {} ns",
+                   timer::time_step::get_tps_dt().count(), tick_rate.count());
+            assert(false && "every live server_app of a process must use the same tick rate");
+        }
+        frame_pacer_.set_target_frame_time(timer::time_step::get_tps_dt());
+        dispatcher_.sink<event::quit_game>().connect<&server_app::receive_quit_game>(*this);
+    }
+
+    //! Public callbacks
+    void server_app::receive_quit_game(const event::quit_game &evt) noexcept {
+        LOG_SCOPE_FUNCTION(INFO);
+        DVLOG_F(loguru::Verbosity_WARNING, "Received quit game event");
+        this->is_running_ = false;
+        this->game_return_value_ = evt.return_value_;
+    }
+
+    int server_app::run() noexcept {
+        LOG_SCOPE_FUNCTION(INFO);
+        if (not system_manager_.nb_systems()) {
+            return this->game_return_value_;
+        }
+        this->dispatcher_.trigger<event::start_game>();
+        this->is_running_ = true;
+        this->system_manager_.start();
+        while (this->is_running_) {
+            process_one_frame();
+            if (entity_registry_.ctx<timer::time_step>().get_clock_source() == timer::clock_source::steady) {
+                frame_pacer_.wait_next_frame();
+            }
+        }
+        return this->game_return_value_;
+    }
+
+    void server_app::process_one_frame() {
+        this->system_manager_.update();
+    }
+
+    server_app::~server_app() noexcept {
+        LOG_SCOPE_FUNCTION(INFO);
+        DVLOG_F(loguru::Verbosity_INFO, "Stopping server with value: {}", game_return_value_);
+        nb_live_servers_.fetch_sub(1u);
+    }
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C++ System Headers
+#include <atomic> ///< std::atomic_size_t
+#include <chrono> ///< std::chrono::nanoseconds
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry
+#include <entt/signal/dispatcher.hpp> ///< entt::dispatcher
+
+//! SDK Headers
+#include "antara/gaming/ecs/system.manager.hpp" ///< ecs::system_manager
+#include "antara/gaming/event/quit.game.hpp" ///< event::quit_game
+#include "antara/gaming/timer/fps.hpp" ///< timer::_60tps_dt
+#include "antara/gaming/timer/frame.pacer.hpp" ///< timer::frame_pacer
+
+namespace antara::gaming::world {
+    /**
+     * @class server_app
+     * @brief Headless counterpart of world::app for dedicated servers: no canvas configuration, no window, no input.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         Render-only components (sprites, texts, layers...) are plain data, they are kept in the registry but nothing draws them.
+     *         Nothing fills transform::properties::global_bounds either, give the collisions::collider a size instead.
+     *         The frame pacer sleeps until the next logic tick, switch the time_step to the virtual clock to run as fast as possible.
+     *         Link against antara::server to get the game logic modules without any window, audio or GPU library.
+     *         The logic rate of timer::time_step is shared by the whole process: the first live server sets it, the next ones
+     *         must use the same tick rate (checked by an assertion, they keep the rate of the first one otherwise).
+     * @endverbatim
+     */
+    class server_app {
+        //! Private static fields
+        static std::atomic_size_t nb_live_servers_;
+
+        //! Private fields
+        bool is_running_{false};
+        int game_return_value_{0};
+    public:
+        //! Constructors
+
+        /// @param tick_rate duration of a logic tick, also the duration of a frame of the server
+        explicit server_app(std::chrono::nanoseconds tick_rate = timer::_60tps_dt) noexcept;
+
+        //! Destructor
+        ~server_app() noexcept;
+
+        //! Public callbacks
+        void receive_quit_game(const event::quit_game &evt) noexcept;
+
+        //! Public member functions
+        int run() noexcept;
+
+        void process_one_frame();
+
+    protected:
+        //! Protected Fields
+        entt::registry entity_registry_;
+        entt::dispatcher &dispatcher_{this->entity_registry_.set<entt::dispatcher>()};
+        ecs::system_manager system_manager_{entity_registry_};
+        timer::frame_pacer &frame_pacer_{this->entity_registry_.set<timer::frame_pacer>()};
+    };
+}
@@ -26,7 +26,14 @@
 #include "antara/gaming/core/real.path.hpp" ///< core::assets_real_path
 #include "antara/gaming/config/config.loading.hpp" ///< config::load_configuration
 #include "antara/gaming/config/config.game.maker.hpp" ///< config::load_configuration<graphics::canvas_2d>
+#include "antara/gaming/event/key.pressed.hpp" ///< event::key_pressed
+#include "antara/gaming/event/key.released.hpp" ///< event::key_released
+#include "antara/gaming/event/mouse.button.pressed.hpp" ///< event::mouse_button_pressed
+#include "antara/gaming/event/mouse.button.released.hpp" ///< event::mouse_button_released
+#include "antara/gaming/event/mouse.moved.hpp" ///< event::mouse_moved
 #include "antara/gaming/event/start.game.hpp" ///< event::start_game, event::quit_game
+#include "antara/gaming/timer/startup.trace.hpp" ///< timer::startup_trace
+#include "antara/gaming/timer/time.step.hpp" ///< timer::time_step, timer::clock_source
 #include "antara/gaming/world/world.app.hpp"
 
 //LCOV_EXCL_START
@@ -38,11 +45,23 @@ namespace antara::gaming::world {
     //! Constructor
     app::app(std::string config_maker_name) noexcept {
         LOG_SCOPE_FUNCTION(INFO);
+        auto config_scope = timer::startup_trace::shared().measure("config loading", config_maker_name);
         auto cfg_maker = config::load_configuration<graphics::canvas_2d>(core::assets_real_path() / "config",
                                                                          std::move(config_maker_name));
+        config_scope.close();
         auto &canvas_2d_cmp = this->entity_registry_.set<graphics::canvas_2d>(cfg_maker);
         canvas_2d_cmp.reset_canvas();
         dispatcher_.sink<event::quit_game>().connect<&app::receive_quit_game>(*this);
+
+        //! vsync already paces the frames, the frame pacer only handles the idle mode then
+        if (canvas_2d_cmp.vsync) {
+            frame_pacer_.set_target_frame_time(std::chrono::nanoseconds::zero());
+        }
+        dispatcher_.sink<event::key_pressed>().connect<&app::receive_input_activity<event::key_pressed>>(*this);
+        dispatcher_.sink<event::key_released>().connect<&app::receive_input_activity<event::key_released>>(*this);
+        dispatcher_.sink<event::mouse_moved>().connect<&app::receive_input_activity<event::mouse_moved>>(*this);
+        dispatcher_.sink<event::mouse_button_pressed>().connect<&app::receive_input_activity<event::mouse_button_pressed>>(*this);
+        dispatcher_.sink<event::mouse_button_released>().connect<&app::receive_input_activity<event::mouse_button_released>>(*this);
     }
 
     //! Public callbacks
@@ -58,6 +77,11 @@ namespace antara::gaming::world {
         //LCOV_EXCL_STOP
     }
 
+    template<typename TEvent>
+    void app::receive_input_activity(const TEvent &) noexcept {
+        frame_pacer_.notify_activity();
+    }
+
     int app::run() noexcept {
         LOG_SCOPE_FUNCTION(INFO);
         if (not system_manager_.nb_systems()) {
@@ -73,6 +97,10 @@ namespace antara::gaming::world {
         //LCOV_EXCL_STOP
         while (this->is_running_) {
             process_one_frame();
+            //! a virtual clock runs the frames as fast as possible
+            if (entity_registry_.ctx<timer::time_step>().get_clock_source() == timer::clock_source::steady) {
+                frame_pacer_.wait_next_frame();
+            }
         }
 #endif
         return this->game_return_value_;
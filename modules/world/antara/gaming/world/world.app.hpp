@@ -26,6 +26,8 @@
 //! SDK Headers
 #include "antara/gaming/ecs/system.manager.hpp" ///< ecs::system_manager
 #include "antara/gaming/event/quit.game.hpp" ///< event::quit_game
+#include "antara/gaming/timer/frame.pacer.hpp" ///< timer::frame_pacer
+#include "antara/gaming/timer/frame.recorder.hpp" ///< timer::frame_recorder
 
 namespace antara::gaming::world {
     class app {
@@ -42,6 +44,10 @@ namespace antara::gaming::world {
         //! Public callbacks
         void receive_quit_game(const event::quit_game &evt) noexcept;
 
+        /// @brief inputs keep the frame pacer out of its idle mode
+        template<typename TEvent>
+        void receive_input_activity(const TEvent &evt) noexcept;
+
         //! Public member functions
         int run() noexcept;
 
@@ -52,5 +58,7 @@ namespace antara::gaming::world {
         entt::registry entity_registry_;
         entt::dispatcher &dispatcher_{this->entity_registry_.set<entt::dispatcher>()};
         ecs::system_manager system_manager_{entity_registry_};
+        timer::frame_pacer &frame_pacer_{this->entity_registry_.set<timer::frame_pacer>()};
+        timer::frame_recorder &frame_recorder_{this->entity_registry_.set<timer::frame_recorder>()};
     };
 }
\ No newline at end of file
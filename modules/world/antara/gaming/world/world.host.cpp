@@ -0,0 +1,156 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+//! C++ System Headers
+#include <algorithm> ///< std::count_if, std::find
+
+//! Dependencies Headers
+#include <loguru.hpp> ///< DVLOG_F
+
+//! SDK Headers
+#include "antara/gaming/event/start.game.hpp" ///< event::start_game
+#include "antara/gaming/timer/time.step.hpp" ///< timer::time_step, timer::clock_source
+#include "antara/gaming/world/world.host.hpp"
+
+namespace antara::gaming::world {
+    hosted_world::hosted_world(const entt::registry &resources) noexcept {
+        entity_registry_.set<shared_resources>(shared_resources{&resources});
+        entity_registry_.ctx<timer::time_step>().set_clock_source(timer::clock_source::virtual_time);
+        dispatcher_.sink<event::quit_game>().connect<&hosted_world::receive_quit_game>(*this);
+    }
+
+    hosted_world::~hosted_world() noexcept {
+        dispatcher_.sink<event::quit_game>().disconnect(*this);
+    }
+
+    void hosted_world::receive_quit_game(const event::quit_game &evt) noexcept {
+        is_running_ = false;
+        return_value_ = evt.return_value_;
+    }
+
+    void hosted_world::step() noexcept {
+        if (not is_running_) {
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        if (not is_started_) {
+            is_started_ = true;
+            dispatcher_.trigger<event::start_game>();
+            system_manager_.start();
+        }
+        system_manager_.update();
+        cpu_time_ += std::chrono::steady_clock::now() - start;
+        ++nb_frames_;
+    }
+
+    entt::registry &hosted_world::get_registry() noexcept {
+        return entity_registry_;
+    }
+
+    entt::dispatcher &hosted_world::get_dispatcher() noexcept {
+        return dispatcher_;
+    }
+
+    ecs::system_manager &hosted_world::get_system_manager() noexcept {
+        return system_manager_;
+    }
+
+    bool hosted_world::is_running() const noexcept {
+        return is_running_;
+    }
+
+    int hosted_world::get_return_value() const noexcept {
+        return return_value_;
+    }
+
+    std::chrono::nanoseconds hosted_world::get_cpu_time() const noexcept {
+        return cpu_time_;
+    }
+
+    std::uint64_t hosted_world::get_nb_frames() const noexcept {
+        return nb_frames_;
+    }
+}
+
+namespace antara::gaming::world {
+    host::host(std::size_t nb_workers) noexcept : pool_(nb_workers) {
+    }
+
+    host::host() noexcept = default;
+
+    host::world_id host::insert_world_(std::unique_ptr<hosted_world> world) noexcept {
+        ++nb_worlds_;
+        //! identifiers of the removed worlds are reused
+        auto free_slot = std::find(worlds_.begin(), worlds_.end(), nullptr);
+        if (free_slot != worlds_.end()) {
+            *free_slot = std::move(world);
+            return static_cast<world_id>(free_slot - worlds_.begin());
+        }
+        worlds_.push_back(std::move(world));
+        return worlds_.size() - 1u;
+    }
+
+    void host::remove_world(world_id id) noexcept {
+        if (id < worlds_.size() && worlds_[id] != nullptr) {
+            worlds_[id].reset();
+            --nb_worlds_;
+        }
+    }
+
+    hosted_world *host::get_world(world_id id) noexcept {
+        return id < worlds_.size() ? worlds_[id].get() : nullptr;
+    }
+
+    std::size_t host::step() noexcept {
+        running_worlds_.clear();
+        for (auto &&world : worlds_) {
+            if (world != nullptr && world->is_running()) {
+                running_worlds_.push_back(world.get());
+            }
+        }
+        pool_.run(running_worlds_.size(), [this](std::size_t idx) { running_worlds_[idx]->step(); });
+        return running_worlds_.size();
+    }
+
+    void host::run() noexcept {
+        LOG_SCOPE_FUNCTION(INFO);
+        std::uint64_t nb_steps = 0u;
+        while (step() > 0u) {
+            ++nb_steps;
+        }
+        DVLOG_F(loguru::Verbosity_INFO, "every hosted world quit after {} steps", nb_steps);
+    }
+
+    std::size_t host::nb_worlds() const noexcept {
+        return nb_worlds_;
+    }
+
+    std::size_t host::nb_running_worlds() const noexcept {
+        return static_cast<std::size_t>(std::count_if(worlds_.begin(), worlds_.end(), [](auto &&world) {
+            return world != nullptr && world->is_running();
+        }));
+    }
+
+    std::chrono::nanoseconds host::get_total_cpu_time() const noexcept {
+        std::chrono::nanoseconds total{0};
+        for (auto &&world : worlds_) {
+            if (world != nullptr) {
+                total += world->get_cpu_time();
+            }
+        }
+        return total;
+    }
+}
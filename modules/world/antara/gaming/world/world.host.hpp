@@ -0,0 +1,186 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C System Headers
+#include <cstddef> ///< std::size_t
+#include <cstdint> ///< std::uint64_t
+
+//! C++ System Headers
+#include <chrono> ///< std::chrono::nanoseconds
+#include <memory> ///< std::unique_ptr
+#include <vector> ///< std::vector
+
+//! Dependencies Headers
+#include <entt/entity/registry.hpp> ///< entt::registry
+#include <entt/signal/dispatcher.hpp> ///< entt::dispatcher
+
+//! SDK Headers
+#include "antara/gaming/ecs/system.manager.hpp" ///< ecs::system_manager
+#include "antara/gaming/ecs/worker.pool.hpp" ///< ecs::worker_pool
+#include "antara/gaming/event/quit.game.hpp" ///< event::quit_game
+
+namespace antara::gaming::world {
+    /**
+     * @struct shared_resources
+     * @brief Read-only resources of a host (configs, textures, lua bytecode...), set in the context of every hosted world.
+     */
+    struct shared_resources {
+        const entt::registry *resources{nullptr};
+
+        /// @return the resource shared by the host, nullptr if there is none
+        template<typename TResource>
+        [[nodiscard]] const TResource *get() const noexcept;
+    };
+
+    /**
+     * @class hosted_world
+     * @brief A world stepped by a host: its own registry, dispatcher, system_manager and time_step.
+     * @note a hosted world runs on the virtual clock by default, switch its time_step back to the steady clock to pace it in real time.
+     */
+    class hosted_world {
+    public:
+        //! Constructors
+        explicit hosted_world(const entt::registry &resources) noexcept;
+
+        hosted_world(const hosted_world &) = delete;
+
+        hosted_world &operator=(const hosted_world &) = delete;
+
+        //! Destructor
+        ~hosted_world() noexcept;
+
+        //! Public callbacks
+        void receive_quit_game(const event::quit_game &evt) noexcept;
+
+        //! Public member functions
+
+        /// @brief process one frame of the world, the first one starts the game.
+        void step() noexcept;
+
+        //! Public getters
+        [[nodiscard]] entt::registry &get_registry() noexcept;
+
+        [[nodiscard]] entt::dispatcher &get_dispatcher() noexcept;
+
+        [[nodiscard]] ecs::system_manager &get_system_manager() noexcept;
+
+        [[nodiscard]] bool is_running() const noexcept;
+
+        [[nodiscard]] int get_return_value() const noexcept;
+
+        /// @return time spent stepping this world, measured on the worker which stepped it
+        [[nodiscard]] std::chrono::nanoseconds get_cpu_time() const noexcept;
+
+        [[nodiscard]] std::uint64_t get_nb_frames() const noexcept;
+
+    private:
+        //! Private fields
+        entt::registry entity_registry_;
+        entt::dispatcher &dispatcher_{this->entity_registry_.set<entt::dispatcher>()};
+        ecs::system_manager system_manager_{entity_registry_};
+        bool is_started_{false};
+        bool is_running_{true};
+        int return_value_{0};
+        std::chrono::nanoseconds cpu_time_{0};
+        std::uint64_t nb_frames_{0u};
+    };
+
+    /**
+     * @class host
+     * @brief Owner of many independent worlds in one process, stepped concurrently across a worker pool.
+     *
+     * @verbatim embed:rst:leading-asterisk
+     *      .. note::
+     *         A world is only touched by one worker at a time, worlds don't share any mutable state.
+     *         Resources are shared between the worlds through share(), they must not be modified once the worlds are stepped.
+     *         The input::virtual_input state stays process-wide, hosted worlds are meant to run without the virtual_input_system.
+     *
+     *      .. code-block:: cpp
+     *
+     *          world::host host;
+     *          host.share<config::game_rules>(load_rules());
+     *          for (auto &&replay : replays) {
+     *              host.add_world([&replay](world::hosted_world &world) {
+     *                  world.get_system_manager().create_system<match_validation_system>(replay);
+     *              });
+     *          }
+     *          host.run();
+     * @endverbatim
+     */
+    class host {
+    public:
+        //! Public typedefs
+        using world_id = std::size_t;
+
+        //! Constructors
+
+        /// @param nb_workers number of threads spawned in addition to the calling thread
+        explicit host(std::size_t nb_workers) noexcept;
+
+        /// @brief spawns one worker less than the hardware concurrency
+        host() noexcept;
+
+        //! Public member functions
+
+        /// @brief share a read-only resource with every world, set it before stepping the worlds.
+        template<typename TResource, typename ... TArgs>
+        const TResource &share(TArgs &&...args);
+
+        /**
+         * @brief create a world and call setup(hosted_world &) to create its systems and entities.
+         * @return identifier of the world, stable until it is removed
+         */
+        template<typename TSetup>
+        world_id add_world(TSetup &&setup);
+
+        void remove_world(world_id id) noexcept;
+
+        /// @return the world, nullptr if the identifier is unknown or the world was removed
+        [[nodiscard]] hosted_world *get_world(world_id id) noexcept;
+
+        /**
+         * @brief step every running world once across the worker pool.
+         * @return number of worlds stepped
+         */
+        std::size_t step() noexcept;
+
+        /// @brief step the worlds until every one of them quit.
+        void run() noexcept;
+
+        [[nodiscard]] std::size_t nb_worlds() const noexcept;
+
+        [[nodiscard]] std::size_t nb_running_worlds() const noexcept;
+
+        /// @return sum of the cpu time of every world still hosted
+        [[nodiscard]] std::chrono::nanoseconds get_total_cpu_time() const noexcept;
+
+    private:
+        //! Private fields
+        entt::registry resources_;
+        std::vector<std::unique_ptr<hosted_world>> worlds_;
+        std::vector<hosted_world *> running_worlds_;
+        std::size_t nb_worlds_{0u};
+        ecs::worker_pool pool_;
+
+        //! Private member functions
+        world_id insert_world_(std::unique_ptr<hosted_world> world) noexcept;
+    };
+}
+
+//! Implementation
+#include "antara/gaming/world/world.host.ipp"
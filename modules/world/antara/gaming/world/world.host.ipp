@@ -0,0 +1,39 @@
+/******************************************************************************
+ * Copyright © 2013-2019 The Komodo Platform Developers.                      *
+ *                                                                            *
+ * See the AUTHORS, DEVELOPER-AGREEMENT and LICENSE files at                  *
+ * the top-level directory of this distribution for the individual copyright  *
+ * holder information and the developer policies on copyright and licensing.  *
+ *                                                                            *
+ * Unless otherwise agreed in a custom licensing agreement, no part of the    *
+ * Komodo Platform software, including this file may be copied, modified,     *
+ * propagated or distributed except according to the terms contained in the   *
+ * LICENSE file                                                               *
+ *                                                                            *
+ * Removal or modification of this copyright notice is prohibited.            *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+//! C++ System Headers
+#include <utility> ///< std::forward
+
+namespace antara::gaming::world {
+    template<typename TResource>
+    const TResource *shared_resources::get() const noexcept {
+        return resources != nullptr ? resources->try_ctx<TResource>() : nullptr;
+    }
+
+    template<typename TResource, typename ... TArgs>
+    const TResource &host::share(TArgs &&...args) {
+        return resources_.set<TResource>(std::forward<TArgs>(args)...);
+    }
+
+    template<typename TSetup>
+    host::world_id host::add_world(TSetup &&setup) {
+        auto world = std::make_unique<hosted_world>(resources_);
+        std::forward<TSetup>(setup)(*world);
+        return insert_world_(std::move(world));
+    }
+}